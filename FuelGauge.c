@@ -2,33 +2,44 @@
 #include "CommonDefinesAndMacros.h"
 
 /*
- * Note:    This was originally used with FreeRTOS so delays were doe through vTaskDelay. 
- *          These lines are commented out but replace with your own delay() call.
+ * Note:    This was originally used with FreeRTOS so delays were done through vTaskDelay.
+ *          Delays now go through the FuelGaugeClock hooks; without them the driver does not wait.
 */
 
 #include "FuelGauge.h"
 #include "GoldenImage.h"
+#include "GoldenImageFormat.h"
 
 
 /**
  *  Defines
  */
-#define FUEL_GAUGE_I2C_ADDRESS              0x55 // 0xAA is the 8-bit address
-#define FUEL_GAUGE_ROM_I2C_ADDRESS          0x0B // 0x16 is the 8-bit address
-#define FUEL_GAUGE_TWI_SPEED                TWI_100KHZ
-
 #define FUEL_GAUGE_REG_CONTROL_STATUS       0x00
+#define FUEL_GAUGE_REG_AT_RATE              0x02
+#define FUEL_GAUGE_REG_AT_RATE_TTE          0x04
+#define FUEL_GAUGE_REG_TEMPERATURE          0x06
 #define FUEL_GAUGE_REG_VOLT                 0x08
 #define FUEL_GAUGE_REG_BATTERY_STATUS       0x0A
 #define FUEL_GAUGE_REG_CURRENT              0x0C
 #define FUEL_GAUGE_REG_REMAINING_CAP        0x10
 #define FUEL_GAUGE_REG_FULL_CAP             0x12
+#define FUEL_GAUGE_REG_AVG_CURRENT          0x14
+#define FUEL_GAUGE_REG_AVG_TTE              0x16
+#define FUEL_GAUGE_REG_AVG_TTF              0x18
+#define FUEL_GAUGE_REG_MAX_LOAD_CURRENT     0x1E
+#define FUEL_GAUGE_REG_MAX_LOAD_TTE         0x20
+#define FUEL_GAUGE_REG_AVG_POWER            0x22
+#define FUEL_GAUGE_REG_INT_TEMPERATURE      0x28
+#define FUEL_GAUGE_REG_CYCLE_COUNT          0x2A
 #define FUEL_GAUGE_REG_RELATIVE_SOC         0x2C
 #define FUEL_GAUGE_REG_RELATIVE_SOH         0x2E
+#define FUEL_GAUGE_REG_CHARGING_VOLT        0x30
+#define FUEL_GAUGE_REG_CHARGING_CURRENT     0x32
 #define FUEL_GAUGE_REG_DESIGN_CAP           0x3C
 #define FUEL_GAUGE_REG_ALT_MNFG_ACCESS      0x3E
 
 #define FUEL_GAUGE_REG_MAC_DATA_SUM         0x60
+#define FUEL_GAUGE_REG_MAC_DATA_LEN         0x61
 #define FUEL_GAUGE_REG_VOLT_HI_SET_TH       0x62
 #define FUEL_GAUGE_REG_VOLT_HI_CLR_TH       0x64
 #define FUEL_GAUGE_REG_VOLT_LO_SET_TH       0x66
@@ -37,14 +48,27 @@
 #define FUEL_GAUGE_REG_TEMP_HI_CLR_TH       0x6B
 #define FUEL_GAUGE_REG_TEMP_LO_SET_TH       0x6C
 #define FUEL_GAUGE_REG_TEMP_LO_CLR_TH       0x6D
+#define FUEL_GAUGE_REG_INTERRUPT_STATUS     0x6E
+#define FUEL_GAUGE_THRESHOLDS_SIZE          (FUEL_GAUGE_REG_TEMP_LO_CLR_TH + 1 - FUEL_GAUGE_REG_VOLT_HI_SET_TH)
 
 #define FUEL_GAUGE_DF_POWER_CONFIG          0x4643
+#define FUEL_GAUGE_ROM_REG_EXIT             0x08 // ROM mode: return to firmware
+#define FUEL_GAUGE_ROM_REG_DF_WRITE         0x0F // ROM mode: count, address (LE), data
 #define FUEL_GAUGE_IT_ENABLED_BIT           3
 #define FUEL_GAUGE_LF_ENABLED_BIT           5
 
 #define NUMBER_FUEL_GAUGE_SETUP_REGISTERS   ARRAY_COUNT(registerSetup)
 #define FUEL_GAUGE_ENABLE_DELAY             1900
-#define FUEL_GAUGE_I2C_DELAY                1
+#define FUEL_GAUGE_BUS_FREE_US              66   // minimum idle time between I2C transactions
+#define FUEL_GAUGE_MAX_HOLD_MS              (INT32_MAX / 1000)
+
+// W:/C: payload lengths are kept in a uint8_t
+_Static_assert(FUEL_GAUGE_IMAGE_MAX_DATA <= UINT8_MAX, "FUEL_GAUGE_IMAGE_MAX_DATA must fit in a uint8_t");
+
+#ifdef FUEL_GAUGE_ENABLE_STATS
+// counters are updated with plain atomics, which must not fall back to libatomic locks (e.g. ARMv6-M)
+_Static_assert(__atomic_always_lock_free(sizeof(uint32_t), 0), "FUEL_GAUGE_ENABLE_STATS needs lock-free 32-bit atomics");
+#endif
 
 
 /**
@@ -56,6 +80,40 @@ typedef struct {
     const uint8_t size;
 } Block;
 
+// flash stream line being parsed, one character at a time
+typedef struct {
+    char op;                            // 'W', 'C', 'X' or 0 before the first character
+    bool colon;
+    bool comment;
+    bool digits;
+    int8_t nibble;                      // pending high nibble, -1 if none
+    uint16_t byteCount;
+    uint32_t delay;
+    uint8_t bytes[2 + FUEL_GAUGE_IMAGE_MAX_DATA]; // address, register, data
+} ImageParser;
+
+// state of one flash stream execution
+typedef struct {
+    FuelGaugeDevice *device;
+    bool incremental;
+    bool scanning;                      // first pass of an incremental run, reads only
+    uint16_t rows;                      // data flash row writes seen
+    bool rowsMatch;                     // every row seen so far is already in data flash
+    bool skippingRom;                   // second pass, leaving out the ROM mode session
+    bool blockValid;
+    uint16_t blockAddress;
+    uint8_t block[FUEL_GAUGE_DF_BLOCK_SIZE];
+} ImageRun;
+
+// response decoder of a MAC subcommand, fills in a value of its FUEL_GAUGE_MAC_COMMANDS type
+typedef void (*MacDecoder)(const uint8_t *data, uint8_t size, void *value);
+
+typedef struct {
+    uint16_t command;
+    uint8_t size;                       // response data bytes after the command echo
+    MacDecoder decode;
+} MacCommand;
+
 typedef enum {
     UNSEAL_KEY,
     FULL_ACCESS_KEY,
@@ -65,12 +123,7 @@ typedef enum {
 static const uint8_t unsealKey [] = {0x04, 0x14, 0x36, 0x72};
 static const uint8_t fullAccessKey [] = {0xff, 0xff, 0xff, 0xff};
 
-// status commands (in little-endian format)
-static const uint8_t chemIdCmd [] = {0x06, 0x00};
-static const uint8_t operationStatusCommand [] = {0x54, 0x00};
-static const uint8_t chargingStatusCommand [] = {0x55, 0x00};
-static const uint8_t gaugingStatusCommand [] = {0x56, 0x00};
-static const uint8_t manufacturingStatusCommand [] = {0x57, 0x00};
+// status commands (in little-endian format), MAC subcommands are in FUEL_GAUGE_MAC_COMMANDS
 static const uint8_t updateStatusAddress [] = {0x8c, 0x41};
 // setup commands (in little-endian format)
 static const uint8_t enableImpedanceTrackingCommand [] = {0x21, 0x00};
@@ -81,538 +134,2365 @@ static const uint8_t sealCommand [] = {0x30, 0x00};
 static const uint8_t resetLifetimeCmd [] = {0x28, 0x00};
 static const uint8_t securityKeysCmd [] = {0x35, 0x00};
 static const uint8_t exitRomCmd [] = {0x08};
-//static const uint8_t enterRomCmd [] = {0x00, 0x0f}; // be careful!
+static const uint8_t enterRomCmd [] = {0x00, 0x0f}; // be careful!
 
-static TwiInterface *Twi = NULL;
+// device used by the handle-less API
+static FuelGaugeDevice defaultDevice;
 
 /**
  *  Local function prototypes
  */
-static inline bool PrimedReadOperation(const uint8_t registerAddress,
+static inline bool PrimedReadOperation(FuelGaugeDevice *device,
+                                       const uint8_t registerAddress,
                                        const uint8_t *cmd,
                                        const uint8_t sizeOfCmd,
                                        uint8_t *data,
                                        const uint8_t sizeOfData);
-static inline bool ReadFlashBlock(const uint8_t fgAddress,
+static inline bool ReadFlashBlock(FuelGaugeDevice *device,
+                                  const uint8_t fgAddress,
                                   const uint8_t registerAddress,
                                   uint8_t *value,
                                   const uint8_t size);
-static inline bool WriteFlashBlock(const uint8_t registerAddress,
+static inline bool WriteFlashBlock(FuelGaugeDevice *device,
+                                   const uint8_t registerAddress,
                                    const uint8_t *value,
                                    const uint8_t size);
-static inline bool WriteFlashBlockSafe(const uint8_t fgAddress,
+static inline bool WriteFlashBlockSafe(FuelGaugeDevice *device,
+                                       const uint8_t fgAddress,
                                        const uint8_t registerAddress,
                                        const uint8_t *value,
                                        const uint8_t size);
-static inline bool GetCommon(const uint8_t registerAddress,
+static inline bool GetCommon(FuelGaugeDevice *device,
+                             const uint8_t registerAddress,
                              uint16_t *value);
-static inline bool IsImpedanceTrackingEnabled(void);
-static inline bool IsLifetimeTrackingEnabled(void);
-static inline void GetKey(FuelGaugeSecurityKey desiredKey, uint8_t *key);
+static inline bool RunRequestOnBus(FuelGaugeDevice *device,
+                                   FuelGaugeRequest *request);
+static inline void PutThresholdWord(uint8_t *buffer,
+                                    const uint8_t registerAddress,
+                                    uint16_t value);
+static inline uint16_t GetThresholdWord(const uint8_t *buffer,
+                                        const uint8_t registerAddress);
+static inline uint8_t GetRequestSteps(const FuelGaugeRequest *request);
+static inline bool IsReadStep(const FuelGaugeRequest *request);
+static inline bool IsMacRequest(const FuelGaugeRequest *request);
+static inline bool IsDataFlashRange(const uint16_t address,
+                                    const uint16_t size);
+static inline bool IsMacResponseStep(const FuelGaugeRequest *request);
+static inline bool GetStepTransfer(FuelGaugeDevice *device,
+                                   FuelGaugeRequest *request,
+                                   const uint8_t **registerAddress,
+                                   uint8_t **buffer,
+                                   uint8_t *size);
+static inline FuelGaugeError CheckStep(FuelGaugeDevice *device,
+                                       FuelGaugeRequest *request);
+static inline uint8_t GetRequestAddress(FuelGaugeDevice *device,
+                                        const FuelGaugeRequest *request);
+static inline FuelGaugeError TransferStep(FuelGaugeDevice *device,
+                                          FuelGaugeRequest *request);
+static inline bool StartTransferStep(FuelGaugeDevice *device,
+                                     FuelGaugeRequest *request);
+static inline void FinishRequest(FuelGaugeDevice *device,
+                                 FuelGaugeRequest *request,
+                                 FuelGaugeError error);
+static inline bool RunRequest(FuelGaugeDevice *device,
+                              FuelGaugeRequest *request);
+static inline void CompleteQueuedRequest(FuelGaugeDevice *device,
+                                         FuelGaugeError error);
+static inline bool ScheduleRetry(FuelGaugeDevice *device,
+                                 uint8_t *attempts,
+                                 FuelGaugeError error);
+static inline bool RetryStep(FuelGaugeDevice *device,
+                             FuelGaugeRequest *request,
+                             FuelGaugeError error);
+static inline void RecordResult(FuelGaugeDevice *device,
+                                FuelGaugeError error);
+static inline void CountRequestStart(FuelGaugeDevice *device,
+                                     FuelGaugeRequest *request);
+static inline void CountRequestEnd(FuelGaugeDevice *device,
+                                   FuelGaugeRequest *request,
+                                   bool result);
+static inline void CountOpenFailure(FuelGaugeDevice *device);
+static inline void CountRetry(FuelGaugeDevice *device,
+                              FuelGaugeRequest *request);
+static inline void HoldBus(FuelGaugeDevice *device,
+                           const uint32_t holdUs);
+static inline bool IsBusHeld(FuelGaugeDevice *device);
+static inline void WaitForBus(FuelGaugeDevice *device);
+static inline bool TryOpenBus(FuelGaugeDevice *device,
+                              TwiSpeed speed);
+static inline bool OpenBus(FuelGaugeDevice *device,
+                           TwiSpeed speed);
+static inline bool IsCacheFresh(FuelGaugeDevice *device,
+                                FuelGaugeCacheClass cacheClass,
+                                uint32_t timestamp);
+static inline void CacheStandard(FuelGaugeDevice *device,
+                                 const uint8_t registerAddress,
+                                 uint16_t value);
+static inline FuelGaugeMacCacheEntry *FindMacCache(FuelGaugeDevice *device,
+                                                   const uint8_t registerAddress,
+                                                   const uint8_t *cmd,
+                                                   const uint8_t sizeOfCmd,
+                                                   const uint8_t sizeOfData);
+static inline void CloseBus(FuelGaugeDevice *device);
+static inline uint16_t GetWord(const uint8_t *buffer,
+                               const uint8_t registerAddress);
+static inline uint8_t GetImageAddress(FuelGaugeDevice *device,
+                                      const uint8_t imageAddress);
+static inline FuelGaugeConfigError ExecuteImageStream(ImageRun *run,
+                                                      const FuelGaugeImageReader *reader);
+static inline FuelGaugeConfigError ExecuteImageRecord(ImageRun *run,
+                                                      const bool writeCmd,
+                                                      const uint8_t imageAddress,
+                                                      const uint8_t fgRegister,
+                                                      const uint8_t *data,
+                                                      const uint8_t dataLength);
+static inline bool IsDataFlashRowWrite(ImageRun *run,
+                                       const uint8_t fgAddress,
+                                       const uint8_t fgRegister,
+                                       const uint8_t *data,
+                                       const uint8_t dataLength);
+static inline bool DataFlashRowMatches(ImageRun *run,
+                                       const uint8_t *data,
+                                       const uint8_t dataLength);
+static inline bool IsRomEntryRecord(FuelGaugeDevice *device,
+                                    const bool writeCmd,
+                                    const uint8_t fgAddress,
+                                    const uint8_t fgRegister,
+                                    const uint8_t *data,
+                                    const uint8_t dataLength);
+static inline bool IsRomSessionRecord(ImageRun *run,
+                                      const bool writeCmd,
+                                      const uint8_t fgAddress,
+                                      const uint8_t fgRegister,
+                                      const uint8_t *data,
+                                      const uint8_t dataLength);
+static inline bool ReadDataFlashBlock(FuelGaugeDevice *device,
+                                      const uint16_t address,
+                                      uint8_t *block);
+static inline const uint8_t *GetDataFlashBlock(FuelGaugeDevice *device,
+                                               const uint16_t address);
+static inline bool WriteDataFlashChunk(FuelGaugeDevice *device,
+                                       const Block *chunk);
+static inline FuelGaugeDataFlashBatchBlock *FindBatchBlock(FuelGaugeDataFlashBatch *batch,
+                                                           const uint16_t address);
+static inline void GetBatchSpan(const FuelGaugeDataFlashBatchBlock *block,
+                                uint8_t *first,
+                                uint8_t *last);
+static inline void ResetImageParser(ImageParser *parser);
+static inline FuelGaugeConfigError ParseImageChar(ImageRun *run,
+                                                  ImageParser *parser,
+                                                  const uint8_t c);
+static inline FuelGaugeConfigError FinishImageLine(ImageRun *run,
+                                                   ImageParser *parser);
+static inline bool IsImpedanceTrackingEnabled(FuelGaugeDevice *device);
+static inline bool IsLifetimeTrackingEnabled(FuelGaugeDevice *device);
+static inline void GetKey(FuelGaugeDevice *device,
+                          FuelGaugeSecurityKey desiredKey,
+                          uint8_t *key);
+static inline void DecodeMacU16(const uint8_t *data, uint8_t size, void *value);
+static inline void DecodeMacSTATUS24(const uint8_t *data, uint8_t size, void *value);
+static inline void DecodeMacSTATUS32(const uint8_t *data, uint8_t size, void *value);
+static inline void DecodeMacWORDS(const uint8_t *data, uint8_t size, void *value);
+static inline void DecodeMacBYTES(const uint8_t *data, uint8_t size, void *value);
+
+// MAC subcommands in FuelGaugeMac order
+static const MacCommand macCommands [] = {
+#define FUEL_GAUGE_MAC_ENTRY(name, command, size, decoder)  {command, size, DecodeMac##decoder},
+    FUEL_GAUGE_MAC_COMMANDS(FUEL_GAUGE_MAC_ENTRY)
+#undef FUEL_GAUGE_MAC_ENTRY
+};
 
 
 void FuelGaugeInitTwi(TwiInterface *twi)
 {
-    configASSERT(twi != NULL);
-
-    Twi = twi;
+    FuelGaugeDeviceInit(&defaultDevice, twi);
 }
 
 /**
-* \brief Gets control status from the BQ27Z561.
+* \brief Setup a device handle with the default addresses and bus speed.
 */
-bool FuelGaugeGetControlStatus(uint16_t *controlStatus)
+void FuelGaugeDeviceInit(FuelGaugeDevice *device, TwiInterface *twi)
 {
-    return GetCommon(FUEL_GAUGE_REG_CONTROL_STATUS, controlStatus);
+    configASSERT(device != NULL);
+    configASSERT(twi != NULL);
+
+    memset(device, 0, sizeof(*device));
+
+    device->twi = twi;
+    device->address = FUEL_GAUGE_I2C_ADDRESS;
+    device->romAddress = FUEL_GAUGE_ROM_I2C_ADDRESS;
+    device->speed = FUEL_GAUGE_TWI_SPEED;
+
+    device->retryPolicy.maxAttempts = FUEL_GAUGE_RETRY_ATTEMPTS;
+    device->retryPolicy.backoffUs = FUEL_GAUGE_RETRY_BACKOFF_US;
+    device->retryPolicy.maxBackoffUs = FUEL_GAUGE_RETRY_MAX_BACKOFF_US;
+    device->retryPolicy.retryMask = FUEL_GAUGE_RETRY_ON(FUEL_GAUGE_ERROR_OPEN)
+                                    | FUEL_GAUGE_RETRY_ON(FUEL_GAUGE_ERROR_TRANSFER)
+                                    | FUEL_GAUGE_RETRY_ON(FUEL_GAUGE_ERROR_CHECKSUM);
 }
 
 /**
-* \brief Gets voltage from the BQ27Z561.
+* \brief Gets the device handle used by the functions without a handle.
 */
-bool FuelGaugeGetVoltage(uint16_t *voltage)
+FuelGaugeDevice *FuelGaugeGetDefaultDevice(void)
 {
-    return GetCommon(FUEL_GAUGE_REG_VOLT, voltage);
+    return &defaultDevice;
 }
 
 /**
-* \brief Gets status of battery from the BQ27Z561.
+* \brief Attach a non-blocking I2C/TWI extension to a device.
 */
-bool FuelGaugeGetBatteryStatus(uint16_t *status)
+void FuelGaugeDeviceInitAsync(FuelGaugeDevice *device, const FuelGaugeTwiAsync *twiAsync)
 {
-    return GetCommon(FUEL_GAUGE_REG_BATTERY_STATUS, status);
+    configASSERT(device != NULL);
+    configASSERT(twiAsync != NULL);
+    configASSERT(device->queueHead == NULL);
+
+    device->twiAsync = twiAsync;
 }
 
 /**
-* \brief Gets manufacturing status of battery from the BQ27Z561.
+* \brief Attach a clock to a device to enforce I2C timing.
 */
-bool FuelGaugeGetManufacturingStatus(uint16_t *status)
+void FuelGaugeDeviceInitClock(FuelGaugeDevice *device, const FuelGaugeClock *clock)
 {
-    uint8_t values [] = {0xff, 0xff, 0xff, 0xff};
+    configASSERT(device != NULL);
+    configASSERT(clock == NULL || (clock->getTimeUs != NULL && clock->delayUs != NULL));
 
-    bool result = PrimedReadOperation(FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                                      manufacturingStatusCommand,
-                                      sizeof(manufacturingStatusCommand),
-                                      values,
-                                      sizeof(values));
-
-    (*status) = ((values[3] << 8) | values[2]);
-
-    return result;
+    device->clock = clock;
+    device->busHeld = false;
 }
 
 /**
-* \brief Gets operation status for the BQ27Z561.
+* \brief Setup a request that reads size bytes starting at a register.
 */
-bool FuelGaugeGetOperationStatus(uint32_t *opStatus)
+void FuelGaugeRequestInitRead(FuelGaugeRequest *request,
+                              uint8_t registerAddress,
+                              uint8_t *data,
+                              uint8_t size)
 {
-    uint8_t values [] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
-
-    bool result = PrimedReadOperation(FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                                      operationStatusCommand,
-                                      sizeof(operationStatusCommand),
-                                      values,
-                                      sizeof(values));
+    configASSERT(request != NULL);
 
-    (*opStatus) = ((values[3] << 24) | (values[2] << 16) | (values[5] << 8) | values[4]);
+    memset(request, 0, sizeof(*request));
 
-    return result;
+    request->type = FUEL_GAUGE_REQUEST_READ;
+    request->registerAddress = registerAddress;
+    request->data = data;
+    request->sizeOfData = size;
 }
 
 /**
-* \brief Gets gauging status for the BQ27Z561.
+* \brief Setup a request that writes a MAC command and reads the response.
 */
-bool FuelGaugeGetGaugingStatus(uint32_t *gaugingStatus)
+void FuelGaugeRequestInitPrimedRead(FuelGaugeRequest *request,
+                                    uint8_t registerAddress,
+                                    const uint8_t *cmd,
+                                    uint8_t sizeOfCmd,
+                                    uint8_t *data,
+                                    uint8_t size)
 {
-    uint8_t values [] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
-
-    bool result = PrimedReadOperation(FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                                      gaugingStatusCommand,
-                                      sizeof(gaugingStatusCommand),
-                                      values,
-                                      sizeof(values));
+    // the response block holds the command echo and up to 32 data bytes
+    configASSERT(registerAddress != FUEL_GAUGE_REG_ALT_MNFG_ACCESS
+                 || size <= FUEL_GAUGE_REG_MAC_DATA_SUM - FUEL_GAUGE_REG_ALT_MNFG_ACCESS);
 
-    (*gaugingStatus) = ((values[3] << 24) | (values[2] << 16) | (values[5] << 8) | values[4]);
+    FuelGaugeRequestInitRead(request, registerAddress, data, size);
 
-    return result;
+    request->type = FUEL_GAUGE_REQUEST_PRIMED_READ;
+    request->cmd = cmd;
+    request->sizeOfCmd = sizeOfCmd;
 }
 
 /**
-* \brief Gets charging status for the BQ27Z561.
+* \brief Setup a request that writes size bytes starting at a register.
 */
-bool FuelGaugeGetChargingStatus(uint32_t *chargingStatus)
+void FuelGaugeRequestInitWrite(FuelGaugeRequest *request,
+                               uint8_t registerAddress,
+                               const uint8_t *data,
+                               uint8_t size)
 {
-    uint8_t values [] = {0xff, 0xff, 0xff, 0xff, 0xff};
-
-    bool result = PrimedReadOperation(FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                                      chargingStatusCommand,
-                                      sizeof(chargingStatusCommand),
-                                      values,
-                                      sizeof(values));
+    configASSERT(request != NULL);
 
-    // Returns three bytes. Upper byte is Temp range, lower 2 bytes are charging status flags.
-    (*chargingStatus) = 0x0;
-    (*chargingStatus) = ((values[2] << 16) | (values[4] << 8) | values[3]);
+    memset(request, 0, sizeof(*request));
 
-    return result;
+    request->type = FUEL_GAUGE_REQUEST_WRITE;
+    request->registerAddress = registerAddress;
+    request->cmd = data;
+    request->sizeOfCmd = size;
 }
 
 /**
-* \brief Gets Chem ID of battery programmed on the BQ27Z561.
+* \brief Queues a request on a device with a non-blocking extension.
 */
-bool FuelGaugeGetChemId(uint16_t *chemId)
+bool FuelGaugeDevSubmitRequest(FuelGaugeDevice *device, FuelGaugeRequest *request)
 {
-    uint8_t values [] = {0xff, 0xff, 0xff, 0xff};
-
-    bool result = PrimedReadOperation(FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                                      chemIdCmd,
-                                      sizeof(chemIdCmd),
-                                      values,
-                                      sizeof(values));
+    configASSERT(device->twiAsync != NULL);
+    configASSERT(request != NULL);
 
-    (*chemId) = ((values[3] << 8) | values[2]);
+    if (request->state == FUEL_GAUGE_REQUEST_QUEUED || request->state == FUEL_GAUGE_REQUEST_BUSY)
+        return false;
 
-    return result;
-}
+    request->state = FUEL_GAUGE_REQUEST_QUEUED;
+    request->error = FUEL_GAUGE_ERROR_NONE;
+    request->step = 0;
+    request->attempts = 0;
+    request->next = NULL;
 
-bool FuelGaugeGetUpdateStatus(uint8_t *updateStatus)
-{
-    uint8_t value [] = {0xff, 0xff, 0xff};
+    CountRequestStart(device, request);
 
-    bool result = PrimedReadOperation(FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                                      updateStatusAddress,
-                                      ARRAY_COUNT(updateStatusAddress),
-                                      value,
-                                      sizeof(value));
+    if (device->queueTail == NULL)
+        device->queueHead = request;
+    else
+        device->queueTail->next = request;
 
-    (*updateStatus) = value[2];
+    device->queueTail = request;
 
-    return result;
+    return true;
 }
 
 /**
-* \brief Gets current from the BQ27Z561.
+* \brief Reports the end of the transfer started through FuelGaugeTwiAsync.
 */
-bool FuelGaugeGetCurrent(int16_t *current)
+void FuelGaugeDevTransferComplete(FuelGaugeDevice *device, bool result)
 {
-    return GetCommon(FUEL_GAUGE_REG_CURRENT, (uint16_t *) current);
+    // only flags here, ProcessRequests() holds the bus when it sees the completion
+    device->transferResult = result;
+    device->transferPending = false;
 }
 
 /**
-* \brief Gets remaining battery capacity from the BQ27Z561.
+* \brief Advances the request engine of a device.
 */
-bool FuelGaugeGetRemainingCapacity(uint16_t *capacity)
+bool FuelGaugeDevProcessRequests(FuelGaugeDevice *device)
 {
-    return GetCommon(FUEL_GAUGE_REG_REMAINING_CAP, capacity);
+    configASSERT(device->twiAsync != NULL);
+
+    while (device->queueHead != NULL) {
+        FuelGaugeRequest *request = device->queueHead;
+
+        if (request->state == FUEL_GAUGE_REQUEST_QUEUED) {
+            if (device->asyncBusOpen == false) {
+                // a failed open is tried again on a later call, after the backoff
+                if (IsBusHeld(device) == true)
+                    return true;
+
+                if (TryOpenBus(device, device->speed) == false) {
+                    if (ScheduleRetry(device, &request->attempts, FUEL_GAUGE_ERROR_OPEN) == true)
+                        return true;
+
+                    CompleteQueuedRequest(device, FUEL_GAUGE_ERROR_OPEN);
+                    continue;
+                }
+
+                // hold a session reference so sync Begin/EndSession cannot close the bus
+                request->attempts = 0;
+                device->sessionDepth++;
+                device->asyncBusOpen = true;
+            }
+
+            // leave the bus idle for its minimum time or retry backoff without blocking
+            if (IsBusHeld(device) == true)
+                return true;
+
+            // starts the first step, the next one or the step being retried
+            request->state = FUEL_GAUGE_REQUEST_BUSY;
+        } else {
+            // request is busy, wait for its transfer to finish
+            if (device->transferPending == true)
+                return true;
+
+            // minimum 66-us delay required before next I2C transaction
+            HoldBus(device, FUEL_GAUGE_BUS_FREE_US);
+
+            FuelGaugeError error = (device->transferResult == true) ? CheckStep(device, request)
+                                                                    : FUEL_GAUGE_ERROR_TRANSFER;
+
+            if (error != FUEL_GAUGE_ERROR_NONE) {
+                if (RetryStep(device, request, error) == true)
+                    request->state = FUEL_GAUGE_REQUEST_QUEUED;
+                else
+                    CompleteQueuedRequest(device, error);
+
+                continue;
+            }
+
+            if (request->step + 1 >= GetRequestSteps(request)) {
+                CompleteQueuedRequest(device, FUEL_GAUGE_ERROR_NONE);
+                continue;
+            }
+
+            // the next step waits out the bus hold as a queued request, so the
+            // completion above is seen, and the bus held, only once
+            request->step++;
+            request->attempts = 0;
+            request->state = FUEL_GAUGE_REQUEST_QUEUED;
+            continue;
+        }
+
+        if (StartTransferStep(device, request) == true)
+            return true;
+
+        // a transfer that cannot be started fails like a NACKed one
+        device->transferResult = false;
+    }
+
+    if (device->asyncBusOpen == true) {
+        device->sessionDepth--;
+        device->asyncBusOpen = false;
+        CloseBus(device);
+    }
+
+    return false;
 }
 
-/**
-* \brief Gets predicted fully-charged battery capacity from the BQ27Z561.
-*/
-bool FuelGaugeGetFullChargeCapacity(uint16_t *capacity)
+/*
+ * Handle-less API, forwarded to the default device.
+ */
+void FuelGaugeInitClock(const FuelGaugeClock *clock)
 {
-    return GetCommon(FUEL_GAUGE_REG_FULL_CAP, capacity);
+    FuelGaugeDeviceInitClock(&defaultDevice, clock);
 }
 
-/**
-* \brief Gets relative state-of-charge (SoC) as % from the BQ27Z561.
-*/
-bool FuelGaugeGetRelativeSoc(uint16_t *soc)
+bool FuelGaugeBeginSession(void)
 {
-    return GetCommon(FUEL_GAUGE_REG_RELATIVE_SOC, soc);
+    return FuelGaugeDevBeginSession(&defaultDevice);
 }
 
-/**
-* \brief Gets the state-of-health (SoH) information of the battery in
-*   percentage of Design Capacity from the BQ27Z561.
-*/
-bool FuelGaugeGetSoh(uint16_t *soh)
+void FuelGaugeEndSession(void)
 {
-    return GetCommon(FUEL_GAUGE_REG_RELATIVE_SOH, soh);
+    FuelGaugeDevEndSession(&defaultDevice);
 }
 
-/**
-* \brief Gets design capacity for the BQ27Z561.
-*/
-bool FuelGaugeGetCapacity(uint16_t *capacity)
+void FuelGaugeSetRetryPolicy(const FuelGaugeRetryPolicy *policy)
 {
-    return GetCommon(FUEL_GAUGE_REG_DESIGN_CAP, capacity);
+    FuelGaugeDevSetRetryPolicy(&defaultDevice, policy);
 }
 
-/**
-* \brief Enable the Impedance Tracking algorithm on the BQ27Z561.
-*/
-bool FuelGaugeEnableImpedanceTracking(void)
+FuelGaugeError FuelGaugeGetLastError(void)
 {
-    if (IsImpedanceTrackingEnabled() == true) // IT already enabled
-        return true;
+    return FuelGaugeDevGetLastError(&defaultDevice);
+}
 
-    WriteFlashBlockSafe(FUEL_GAUGE_I2C_ADDRESS,
-                        FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                        enableImpedanceTrackingCommand,
-                        sizeof(enableImpedanceTrackingCommand));
+void FuelGaugeCacheEnable(const FuelGaugeCacheConfig *config)
+{
+    FuelGaugeDevCacheEnable(&defaultDevice, config);
+}
 
-    return IsImpedanceTrackingEnabled();
+void FuelGaugeCacheDisable(void)
+{
+    FuelGaugeDevCacheDisable(&defaultDevice);
 }
 
-/**
-* \brief Disable the Impedance Tracking algorithm on the BQ27Z561.
-*/
-bool FuelGaugeDisableImpedanceTracking(void)
+void FuelGaugeCacheInvalidate(void)
 {
-    if (IsImpedanceTrackingEnabled() == true) {
-        WriteFlashBlockSafe(FUEL_GAUGE_I2C_ADDRESS,
-                            FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                            disableImpedanceTrackingCommand,
-                            sizeof(disableImpedanceTrackingCommand));
-    }
+    FuelGaugeDevCacheInvalidate(&defaultDevice);
+}
 
-    return IsImpedanceTrackingEnabled();
+void FuelGaugeCacheGetStats(FuelGaugeCacheStats *stats)
+{
+    FuelGaugeDevCacheGetStats(&defaultDevice, stats);
 }
 
-/**
-* \brief Enable the Lifetime Tracking algorithm on the BQ27Z561.
-*/
-bool FuelGaugeEnableLifetimeTracking(void)
+#ifdef FUEL_GAUGE_ENABLE_STATS
+void FuelGaugeGetStats(FuelGaugeStats *stats)
 {
-    if (IsLifetimeTrackingEnabled() == true) // Lifetime already enabled
-        return true;
+    FuelGaugeDevGetStats(&defaultDevice, stats);
+}
 
-    WriteFlashBlockSafe(FUEL_GAUGE_I2C_ADDRESS,
-                        FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                        lifetimeTrackingCommand,
-                        sizeof(lifetimeTrackingCommand));
+void FuelGaugeResetStats(void)
+{
+    FuelGaugeDevResetStats(&defaultDevice);
+}
+#endif
 
-    return IsLifetimeTrackingEnabled();
+bool FuelGaugeGetControlStatus(uint16_t *controlStatus)
+{
+    return FuelGaugeDevGetControlStatus(&defaultDevice, controlStatus);
 }
 
-/**
-* \brief Disable the Lifetime Tracking algorithm on the BQ27Z561.
-*/
-bool FuelGaugeDisableLifetimeTracking(void)
+bool FuelGaugeGetVoltage(uint16_t *voltage)
 {
-    if (IsImpedanceTrackingEnabled() == true) {
-        WriteFlashBlockSafe(FUEL_GAUGE_I2C_ADDRESS,
-                            FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                            lifetimeTrackingCommand,
-                            sizeof(lifetimeTrackingCommand));
-    }
+    return FuelGaugeDevGetVoltage(&defaultDevice, voltage);
+}
 
-    return IsLifetimeTrackingEnabled();
+bool FuelGaugeGetBatteryStatus(uint16_t *status)
+{
+    return FuelGaugeDevGetBatteryStatus(&defaultDevice, status);
 }
 
-/**
-* \brief Resets the BQ27Z561.
-*/
-bool FuelGaugeReset(void)
+bool FuelGaugeReadSnapshot(FuelGaugeSnapshot *snapshot)
 {
-    bool result = WriteFlashBlockSafe(FUEL_GAUGE_I2C_ADDRESS,
-                                      FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                                      resetCommand,
-                                      sizeof(resetCommand));
+    return FuelGaugeDevReadSnapshot(&defaultDevice, snapshot);
+}
 
-    return result;
+bool FuelGaugeReadMac(FuelGaugeMac mac, void *value)
+{
+    return FuelGaugeDevReadMac(&defaultDevice, mac, value);
 }
 
-/**
-* \brief Unseals the BQ27Z561.
-*/
-bool FuelGaugeUnseal(void)
+bool FuelGaugeReadMacs(const FuelGaugeMac *macs, void *const *values, uint8_t count)
 {
-    configASSERT(Twi != NULL);
+    return FuelGaugeDevReadMacs(&defaultDevice, macs, values, count);
+}
 
-    uint8_t keyFirstWord[] = {unsealKey[0], unsealKey[1]};
-    uint8_t keySecondWord[] = {unsealKey[2], unsealKey[3]};
+bool FuelGaugeReadDiagnostics(FuelGaugeDiagnostics *diagnostics)
+{
+    return FuelGaugeDevReadDiagnostics(&defaultDevice, diagnostics);
+}
 
-    bool result = false;
+bool FuelGaugeDataFlashRead(uint16_t address, uint8_t *data, uint16_t size)
+{
+    return FuelGaugeDevDataFlashRead(&defaultDevice, address, data, size);
+}
 
-    if (Twi->open(FUEL_GAUGE_TWI_SPEED) == true) {
-        result = WriteFlashBlock(FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                                 keyFirstWord,
-                                 ARRAY_COUNT(keyFirstWord));
+bool FuelGaugeDataFlashWrite(uint16_t address, const uint8_t *data, uint16_t size)
+{
+    return FuelGaugeDevDataFlashWrite(&defaultDevice, address, data, size);
+}
 
-        result &= WriteFlashBlock(FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                                  keySecondWord,
-                                  ARRAY_COUNT(keySecondWord));
+bool FuelGaugeSetThresholds(const FuelGaugeThresholds *thresholds)
+{
+    return FuelGaugeDevSetThresholds(&defaultDevice, thresholds);
+}
 
-        Twi->close();
-    }
+bool FuelGaugeGetThresholds(FuelGaugeThresholds *thresholds)
+{
+    return FuelGaugeDevGetThresholds(&defaultDevice, thresholds);
+}
 
-    return result;
+void FuelGaugeInterruptNotify(void)
+{
+    FuelGaugeDevInterruptNotify(&defaultDevice);
 }
 
-/**
-* \brief Gives full access to the BQ27Z561.
-*/
-bool FuelGaugeFullAccess(void)
+bool FuelGaugeInterruptService(uint8_t *status)
 {
-    configASSERT(Twi != NULL);
-    
-    uint8_t keyFirstWord[] = {fullAccessKey[0], fullAccessKey[1]};
-    uint8_t keySecondWord[] = {fullAccessKey[2], fullAccessKey[3]};
+    return FuelGaugeDevInterruptService(&defaultDevice, status);
+}
 
-    bool result = false;
+FuelGaugeConfigError FuelGaugeDataFlashBatchCommit(FuelGaugeDataFlashBatch *batch)
+{
+    return FuelGaugeDevDataFlashBatchCommit(&defaultDevice, batch);
+}
 
-    if (Twi->open(FUEL_GAUGE_TWI_SPEED) == true) {
-        result = WriteFlashBlock(FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                                 keyFirstWord,
-                                 ARRAY_COUNT(keyFirstWord));
+bool FuelGaugeGetManufacturingStatus(uint16_t *status)
+{
+    return FuelGaugeDevGetManufacturingStatus(&defaultDevice, status);
+}
 
-        result &= WriteFlashBlock(FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                                  keySecondWord,
-                                  ARRAY_COUNT(keySecondWord));
+bool FuelGaugeGetOperationStatus(uint32_t *opStatus)
+{
+    return FuelGaugeDevGetOperationStatus(&defaultDevice, opStatus);
+}
 
-        Twi->close();
-    }
+bool FuelGaugeGetGaugingStatus(uint32_t *gaugingStatus)
+{
+    return FuelGaugeDevGetGaugingStatus(&defaultDevice, gaugingStatus);
+}
 
-    return result;
+bool FuelGaugeGetChargingStatus(uint32_t *chargingStatus)
+{
+    return FuelGaugeDevGetChargingStatus(&defaultDevice, chargingStatus);
 }
 
-/**
-* \brief Seals the BQ27Z561.
-*/
-bool FuelGaugeSeal(void)
+bool FuelGaugeGetChemId(uint16_t *chemId)
 {
-    return WriteFlashBlockSafe(FUEL_GAUGE_I2C_ADDRESS,
-                               FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                               sealCommand,
-                               sizeof(sealCommand));
+    return FuelGaugeDevGetChemId(&defaultDevice, chemId);
 }
 
-/**
-* \brief Resets lifetime history of battery BQ27Z561.
-*/
-bool FuelGaugeResetLifetimeHistory(void)
+bool FuelGaugeGetUpdateStatus(uint8_t *updateStatus)
 {
-    return WriteFlashBlockSafe(FUEL_GAUGE_I2C_ADDRESS,
-                               FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                               resetLifetimeCmd,
-                               sizeof(resetLifetimeCmd));
+    return FuelGaugeDevGetUpdateStatus(&defaultDevice, updateStatus);
 }
 
-/**
-* \brief Send return-to-firmware command if BQ27Z561 is in ROM mode.
-*/
-bool FuelGaugeExitRomMode(void)
+bool FuelGaugeGetCurrent(int16_t *current)
 {
-    configASSERT(Twi != NULL);
+    return FuelGaugeDevGetCurrent(&defaultDevice, current);
+}
 
-    bool result = false;
+bool FuelGaugeGetRemainingCapacity(uint16_t *capacity)
+{
+    return FuelGaugeDevGetRemainingCapacity(&defaultDevice, capacity);
+}
 
-    if (Twi->open(TWI_400KHZ) == true) {
-        result = Twi->write(FUEL_GAUGE_ROM_I2C_ADDRESS,
-                              (uint8_t *)FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
-                              sizeof(uint8_t),
-                              exitRomCmd,
-                              sizeof(exitRomCmd));
+bool FuelGaugeGetFullChargeCapacity(uint16_t *capacity)
+{
+    return FuelGaugeDevGetFullChargeCapacity(&defaultDevice, capacity);
+}
 
-        Twi->close();
-    }
+bool FuelGaugeGetRelativeSoc(uint16_t *soc)
+{
+    return FuelGaugeDevGetRelativeSoc(&defaultDevice, soc);
+}
 
-    return result;
+bool FuelGaugeGetSoh(uint16_t *soh)
+{
+    return FuelGaugeDevGetSoh(&defaultDevice, soh);
+}
+
+bool FuelGaugeGetCapacity(uint16_t *capacity)
+{
+    return FuelGaugeDevGetCapacity(&defaultDevice, capacity);
+}
+
+bool FuelGaugeEnableImpedanceTracking(void)
+{
+    return FuelGaugeDevEnableImpedanceTracking(&defaultDevice);
+}
+
+bool FuelGaugeDisableImpedanceTracking(void)
+{
+    return FuelGaugeDevDisableImpedanceTracking(&defaultDevice);
+}
+
+bool FuelGaugeEnableLifetimeTracking(void)
+{
+    return FuelGaugeDevEnableLifetimeTracking(&defaultDevice);
+}
+
+bool FuelGaugeDisableLifetimeTracking(void)
+{
+    return FuelGaugeDevDisableLifetimeTracking(&defaultDevice);
+}
+
+bool FuelGaugeReset(void)
+{
+    return FuelGaugeDevReset(&defaultDevice);
+}
+
+bool FuelGaugeUnseal(void)
+{
+    return FuelGaugeDevUnseal(&defaultDevice);
+}
+
+bool FuelGaugeFullAccess(void)
+{
+    return FuelGaugeDevFullAccess(&defaultDevice);
+}
+
+bool FuelGaugeSeal(void)
+{
+    return FuelGaugeDevSeal(&defaultDevice);
+}
+
+bool FuelGaugeResetLifetimeHistory(void)
+{
+    return FuelGaugeDevResetLifetimeHistory(&defaultDevice);
+}
+
+bool FuelGaugeExitRomMode(void)
+{
+    return FuelGaugeDevExitRomMode(&defaultDevice);
+}
+
+FuelGaugeConfigError FuelGaugeExecuteGoldenImage(void)
+{
+    return FuelGaugeDevExecuteGoldenImage(&defaultDevice);
+}
+
+FuelGaugeConfigError FuelGaugeExecuteGoldenImageStream(const FuelGaugeImageReader *reader)
+{
+    return FuelGaugeDevExecuteGoldenImageStream(&defaultDevice, reader);
+}
+
+FuelGaugeConfigError FuelGaugeExecuteGoldenImageIncremental(const FuelGaugeImageReader *reader,
+                                                            FuelGaugeImageStats *stats)
+{
+    return FuelGaugeDevExecuteGoldenImageIncremental(&defaultDevice, reader, stats);
+}
+
+FuelGaugeConfigError FuelGaugeExecuteGoldenImageBinary(const uint8_t *image, uint32_t size)
+{
+    return FuelGaugeDevExecuteGoldenImageBinary(&defaultDevice, image, size);
+}
+
+/**
+* \brief Opens the I2C/TWI bus for a batch of fuel gauge operations.
+*/
+bool FuelGaugeDevBeginSession(FuelGaugeDevice *device)
+{
+    configASSERT(device->twi != NULL);
+
+    if (OpenBus(device, device->speed) == false)
+        return false;
+
+    device->sessionDepth++;
+
+    return true;
+}
+
+/**
+* \brief Closes the I2C/TWI bus opened by FuelGaugeDevBeginSession(device).
+*/
+void FuelGaugeDevEndSession(FuelGaugeDevice *device)
+{
+    configASSERT(device->twi != NULL);
+    configASSERT(device->sessionDepth > 0);
+
+    if (--device->sessionDepth == 0)
+        device->twi->close();
+}
+
+/**
+* \brief Sets the retry and bus recovery policy.
+*/
+void FuelGaugeDevSetRetryPolicy(FuelGaugeDevice *device, const FuelGaugeRetryPolicy *policy)
+{
+    configASSERT(policy != NULL);
+
+    device->retryPolicy = (*policy);
+    device->consecutiveFailures = 0;
+}
+
+/**
+* \brief Gets the error of the latest bus operation.
+*/
+FuelGaugeError FuelGaugeDevGetLastError(FuelGaugeDevice *device)
+{
+    return device->lastError;
+}
+
+/**
+* \brief Enables the register result cache.
+*/
+void FuelGaugeDevCacheEnable(FuelGaugeDevice *device, const FuelGaugeCacheConfig *config)
+{
+    configASSERT(config != NULL);
+    configASSERT(config->getTimeMs != NULL);
+
+    device->cacheConfig = (*config);
+    memset(&device->cacheStats, 0, sizeof(device->cacheStats));
+    FuelGaugeDevCacheInvalidate(device);
+    device->cacheEnabled = true;
+}
+
+/**
+* \brief Disables and clears the register result cache.
+*/
+void FuelGaugeDevCacheDisable(FuelGaugeDevice *device)
+{
+    device->cacheEnabled = false;
+    FuelGaugeDevCacheInvalidate(device);
+}
+
+/**
+* \brief Drops every cached value.
+*/
+void FuelGaugeDevCacheInvalidate(FuelGaugeDevice *device)
+{
+    memset(device->standardCache, 0, sizeof(device->standardCache));
+    memset(device->macCache, 0, sizeof(device->macCache));
+    device->macCacheNext = 0;
+    memset(device->dataFlashCache, 0, sizeof(device->dataFlashCache));
+    device->dataFlashCacheNext = 0;
+}
+
+/**
+* \brief Gets cache hit/miss counters per register class.
+*/
+void FuelGaugeDevCacheGetStats(FuelGaugeDevice *device, FuelGaugeCacheStats *stats)
+{
+    configASSERT(stats != NULL);
+
+    (*stats) = device->cacheStats;
+}
+
+#ifdef FUEL_GAUGE_ENABLE_STATS
+/**
+* \brief Gets the request counters and latency histograms.
+*/
+void FuelGaugeDevGetStats(FuelGaugeDevice *device, FuelGaugeStats *stats)
+{
+    configASSERT(stats != NULL);
+
+    for (uint8_t type = 0; type < FUEL_GAUGE_REQUEST_TYPE_COUNT; type++) {
+        const FuelGaugeRequestStats *source = &device->stats.requests[type];
+        FuelGaugeRequestStats *destination = &stats->requests[type];
+
+        destination->calls = __atomic_load_n(&source->calls, __ATOMIC_RELAXED);
+        destination->failures = __atomic_load_n(&source->failures, __ATOMIC_RELAXED);
+        destination->retries = __atomic_load_n(&source->retries, __ATOMIC_RELAXED);
+
+        for (uint8_t bucket = 0; bucket < FUEL_GAUGE_STATS_BUCKETS; bucket++)
+            destination->latency[bucket] = __atomic_load_n(&source->latency[bucket], __ATOMIC_RELAXED);
+    }
+
+    stats->openFailures = __atomic_load_n(&device->stats.openFailures, __ATOMIC_RELAXED);
+}
+
+/**
+* \brief Clears the request counters and latency histograms.
+*/
+void FuelGaugeDevResetStats(FuelGaugeDevice *device)
+{
+    for (uint8_t type = 0; type < FUEL_GAUGE_REQUEST_TYPE_COUNT; type++) {
+        FuelGaugeRequestStats *counters = &device->stats.requests[type];
+
+        __atomic_store_n(&counters->calls, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&counters->failures, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&counters->retries, 0, __ATOMIC_RELAXED);
+
+        for (uint8_t bucket = 0; bucket < FUEL_GAUGE_STATS_BUCKETS; bucket++)
+            __atomic_store_n(&counters->latency[bucket], 0, __ATOMIC_RELAXED);
+    }
+
+    __atomic_store_n(&device->stats.openFailures, 0, __ATOMIC_RELAXED);
+}
+#endif
+
+/**
+* \brief Gets control status from the BQ27Z561.
+*/
+bool FuelGaugeDevGetControlStatus(FuelGaugeDevice *device, uint16_t *controlStatus)
+{
+    return GetCommon(device, FUEL_GAUGE_REG_CONTROL_STATUS, controlStatus);
+}
+
+/**
+* \brief Gets voltage from the BQ27Z561.
+*/
+bool FuelGaugeDevGetVoltage(FuelGaugeDevice *device, uint16_t *voltage)
+{
+    return GetCommon(device, FUEL_GAUGE_REG_VOLT, voltage);
+}
+
+/**
+* \brief Gets status of battery from the BQ27Z561.
+*/
+bool FuelGaugeDevGetBatteryStatus(FuelGaugeDevice *device, uint16_t *status)
+{
+    return GetCommon(device, FUEL_GAUGE_REG_BATTERY_STATUS, status);
+}
+
+/**
+* \brief Reads all standard registers from the BQ27Z561 in one
+*   auto-incrementing I2C read.
+*/
+bool FuelGaugeDevReadSnapshot(FuelGaugeDevice *device, FuelGaugeSnapshot *snapshot)
+{
+    configASSERT(device->twi != NULL);
+    configASSERT(snapshot != NULL);
+
+    uint8_t buffer[FUEL_GAUGE_STANDARD_REG_COUNT];
+    FuelGaugeRequest request;
+    bool result = false;
+
+    FuelGaugeRequestInitRead(&request, FUEL_GAUGE_REG_CONTROL_STATUS, buffer, sizeof(buffer));
+
+    if (OpenBus(device, device->speed) == true) {
+        result = RunRequest(device, &request);
+        CloseBus(device);
+    }
+
+    if (result == false)
+        return false;
+
+    for (uint8_t reg = 0; reg < FUEL_GAUGE_STANDARD_REG_COUNT; reg += sizeof(uint16_t))
+        CacheStandard(device, reg, GetWord(buffer, reg));
+
+    snapshot->controlStatus = GetWord(buffer, FUEL_GAUGE_REG_CONTROL_STATUS);
+    snapshot->atRate = (int16_t) GetWord(buffer, FUEL_GAUGE_REG_AT_RATE);
+    snapshot->atRateTimeToEmpty = GetWord(buffer, FUEL_GAUGE_REG_AT_RATE_TTE);
+    snapshot->temperature = GetWord(buffer, FUEL_GAUGE_REG_TEMPERATURE);
+    snapshot->voltage = GetWord(buffer, FUEL_GAUGE_REG_VOLT);
+    snapshot->batteryStatus = GetWord(buffer, FUEL_GAUGE_REG_BATTERY_STATUS);
+    snapshot->current = (int16_t) GetWord(buffer, FUEL_GAUGE_REG_CURRENT);
+    snapshot->remainingCapacity = GetWord(buffer, FUEL_GAUGE_REG_REMAINING_CAP);
+    snapshot->fullChargeCapacity = GetWord(buffer, FUEL_GAUGE_REG_FULL_CAP);
+    snapshot->averageCurrent = (int16_t) GetWord(buffer, FUEL_GAUGE_REG_AVG_CURRENT);
+    snapshot->averageTimeToEmpty = GetWord(buffer, FUEL_GAUGE_REG_AVG_TTE);
+    snapshot->averageTimeToFull = GetWord(buffer, FUEL_GAUGE_REG_AVG_TTF);
+    snapshot->maxLoadCurrent = (int16_t) GetWord(buffer, FUEL_GAUGE_REG_MAX_LOAD_CURRENT);
+    snapshot->maxLoadTimeToEmpty = GetWord(buffer, FUEL_GAUGE_REG_MAX_LOAD_TTE);
+    snapshot->averagePower = (int16_t) GetWord(buffer, FUEL_GAUGE_REG_AVG_POWER);
+    snapshot->internalTemperature = GetWord(buffer, FUEL_GAUGE_REG_INT_TEMPERATURE);
+    snapshot->cycleCount = GetWord(buffer, FUEL_GAUGE_REG_CYCLE_COUNT);
+    snapshot->relativeSoc = GetWord(buffer, FUEL_GAUGE_REG_RELATIVE_SOC);
+    snapshot->soh = GetWord(buffer, FUEL_GAUGE_REG_RELATIVE_SOH);
+    snapshot->chargingVoltage = GetWord(buffer, FUEL_GAUGE_REG_CHARGING_VOLT);
+    snapshot->chargingCurrent = GetWord(buffer, FUEL_GAUGE_REG_CHARGING_CURRENT);
+    snapshot->designCapacity = GetWord(buffer, FUEL_GAUGE_REG_DESIGN_CAP);
+
+    return true;
+}
+
+/**
+* \brief Gets manufacturing status of battery from the BQ27Z561.
+*/
+bool FuelGaugeDevGetManufacturingStatus(FuelGaugeDevice *device, uint16_t *status)
+{
+    return FuelGaugeDevReadMac(device, FUEL_GAUGE_MAC_MANUFACTURING_STATUS, status);
+}
+
+/**
+* \brief Gets operation status for the BQ27Z561.
+*/
+bool FuelGaugeDevGetOperationStatus(FuelGaugeDevice *device, uint32_t *opStatus)
+{
+    return FuelGaugeDevReadMac(device, FUEL_GAUGE_MAC_OPERATION_STATUS, opStatus);
+}
+
+/**
+* \brief Gets gauging status for the BQ27Z561.
+*/
+bool FuelGaugeDevGetGaugingStatus(FuelGaugeDevice *device, uint32_t *gaugingStatus)
+{
+    return FuelGaugeDevReadMac(device, FUEL_GAUGE_MAC_GAUGING_STATUS, gaugingStatus);
+}
+
+/**
+* \brief Gets charging status for the BQ27Z561.
+*/
+bool FuelGaugeDevGetChargingStatus(FuelGaugeDevice *device, uint32_t *chargingStatus)
+{
+    return FuelGaugeDevReadMac(device, FUEL_GAUGE_MAC_CHARGING_STATUS, chargingStatus);
+}
+
+/**
+* \brief Gets Chem ID of battery programmed on the BQ27Z561.
+*/
+bool FuelGaugeDevGetChemId(FuelGaugeDevice *device, uint16_t *chemId)
+{
+    return FuelGaugeDevReadMac(device, FUEL_GAUGE_MAC_CHEM_ID, chemId);
+}
+
+bool FuelGaugeDevGetUpdateStatus(FuelGaugeDevice *device, uint8_t *updateStatus)
+{
+    uint8_t value [] = {0xff, 0xff, 0xff};
+
+    bool result = PrimedReadOperation(device, FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                                      updateStatusAddress,
+                                      ARRAY_COUNT(updateStatusAddress),
+                                      value,
+                                      sizeof(value));
+
+    (*updateStatus) = value[2];
+
+    return result;
+}
+
+/**
+* \brief Reads a MAC subcommand and decodes its response.
+*/
+bool FuelGaugeDevReadMac(FuelGaugeDevice *device, FuelGaugeMac mac, void *value)
+{
+    configASSERT(mac < FUEL_GAUGE_MAC_COUNT);
+
+    const MacCommand *entry = &macCommands[mac];
+    const uint8_t cmd [] = {(uint8_t) entry->command, (uint8_t) (entry->command >> 8)};
+    uint8_t values[sizeof(cmd) + FUEL_GAUGE_DF_BLOCK_SIZE];
+
+    memset(values, 0xff, sizeof(values));
+
+    bool result = PrimedReadOperation(device, FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                                      cmd,
+                                      sizeof(cmd),
+                                      values,
+                                      sizeof(cmd) + entry->size);
+
+    // the response echoes the subcommand it belongs to
+    if (result == true && memcmp(values, cmd, sizeof(cmd)) != 0)
+        result = false;
+
+    // decoded even on failure, like the status getters always did
+    entry->decode(&values[sizeof(cmd)], entry->size, value);
+
+    return result;
+}
+
+/**
+* \brief Reads several MAC subcommands back to back in one bus session.
+*/
+bool FuelGaugeDevReadMacs(FuelGaugeDevice *device, const FuelGaugeMac *macs, void *const *values, uint8_t count)
+{
+    bool result = FuelGaugeDevBeginSession(device);
+
+    if (result == false)
+        return false;
+
+    for (uint8_t i = 0; i < count; i++)
+        result &= FuelGaugeDevReadMac(device, macs[i], values[i]);
+
+    FuelGaugeDevEndSession(device);
+
+    return result;
+}
+
+/**
+* \brief Reads the status words and status blocks in one bus session.
+*/
+bool FuelGaugeDevReadDiagnostics(FuelGaugeDevice *device, FuelGaugeDiagnostics *diagnostics)
+{
+    static const FuelGaugeMac macs [] = {
+        FUEL_GAUGE_MAC_OPERATION_STATUS,
+        FUEL_GAUGE_MAC_GAUGING_STATUS,
+        FUEL_GAUGE_MAC_CHARGING_STATUS,
+        FUEL_GAUGE_MAC_MANUFACTURING_STATUS,
+        FUEL_GAUGE_MAC_DA_STATUS1,
+        FUEL_GAUGE_MAC_DA_STATUS2,
+        FUEL_GAUGE_MAC_IT_STATUS1,
+        FUEL_GAUGE_MAC_IT_STATUS2,
+        FUEL_GAUGE_MAC_IT_STATUS3,
+        FUEL_GAUGE_MAC_LIFETIME_DATA,
+    };
+    void *const values [] = {
+        &diagnostics->operationStatus,
+        &diagnostics->gaugingStatus,
+        &diagnostics->chargingStatus,
+        &diagnostics->manufacturingStatus,
+        diagnostics->daStatus1,
+        diagnostics->daStatus2,
+        diagnostics->itStatus1,
+        diagnostics->itStatus2,
+        diagnostics->itStatus3,
+        diagnostics->lifetimeData,
+    };
+    uint32_t startUs = (device->clock != NULL) ? device->clock->getTimeUs() : 0;
+
+    bool result = FuelGaugeDevReadMacs(device, macs, values, ARRAY_COUNT(macs));
+
+    diagnostics->busTimeUs = (device->clock != NULL) ? device->clock->getTimeUs() - startUs : 0;
+
+    return result;
+}
+
+/**
+* \brief Reads data flash, block by block through the data flash cache.
+*/
+bool FuelGaugeDevDataFlashRead(FuelGaugeDevice *device, uint16_t address, uint8_t *data, uint16_t size)
+{
+    configASSERT(data != NULL || size == 0);
+
+    // outside data flash the address would be sent as a MAC command
+    if (IsDataFlashRange(address, size) == false)
+        return false;
+
+    for (uint16_t done = 0; done < size;) {
+        uint16_t blockAddress = (address + done) & ~(FUEL_GAUGE_DF_BLOCK_SIZE - 1);
+        uint8_t offset = (address + done) - blockAddress;
+        uint16_t length = FUEL_GAUGE_DF_BLOCK_SIZE - offset;
+        const uint8_t *block = GetDataFlashBlock(device, blockAddress);
+
+        if (block == NULL)
+            return false;
+
+        if (length > size - done)
+            length = size - done;
+
+        memcpy(&data[done], &block[offset], length);
+        done += length;
+    }
+
+    return true;
+}
+
+/**
+* \brief Writes data flash, one transfer per block touched.
+*/
+bool FuelGaugeDevDataFlashWrite(FuelGaugeDevice *device, uint16_t address, const uint8_t *data, uint16_t size)
+{
+    configASSERT(data != NULL || size == 0);
+
+    FuelGaugeDataFlashCacheEntry kept[FUEL_GAUGE_DF_CACHE_BLOCKS];
+    bool result = true;
+
+    if (IsDataFlashRange(address, size) == false)
+        return false;
+
+    if (FuelGaugeDevBeginSession(device) == false)
+        return false;
+
+    // every write drops the caches, the blocks known before are restored with the new bytes
+    memcpy(kept, device->dataFlashCache, sizeof(kept));
+
+    for (uint16_t done = 0; result == true && done < size;) {
+        uint16_t blockAddress = (address + done) & ~(FUEL_GAUGE_DF_BLOCK_SIZE - 1);
+        uint16_t length = FUEL_GAUGE_DF_BLOCK_SIZE - ((address + done) - blockAddress);
+
+        if (length > size - done)
+            length = size - done;
+
+        const Block chunk = {&data[done], address + done, length};
+
+        result = WriteDataFlashChunk(device, &chunk);
+        done += length;
+    }
+
+    FuelGaugeDevEndSession(device);
+
+    if (result == false)
+        return false;
+
+    for (uint8_t i = 0; i < FUEL_GAUGE_DF_CACHE_BLOCKS; i++) {
+        FuelGaugeDataFlashCacheEntry *entry = &kept[i];
+        uint32_t start = (entry->address > address) ? entry->address : address;
+        uint32_t end = (uint32_t) address + size;
+
+        if ((uint32_t) entry->address + FUEL_GAUGE_DF_BLOCK_SIZE < end)
+            end = (uint32_t) entry->address + FUEL_GAUGE_DF_BLOCK_SIZE;
+
+        if (entry->valid == true && start < end)
+            memcpy(&entry->data[start - entry->address], &data[start - address], end - start);
+    }
+
+    memcpy(device->dataFlashCache, kept, sizeof(kept));
+
+    return true;
+}
+
+/**
+* \brief Programs the voltage and temperature thresholds in one transfer.
+*/
+bool FuelGaugeDevSetThresholds(FuelGaugeDevice *device, const FuelGaugeThresholds *thresholds)
+{
+    configASSERT(thresholds != NULL);
+
+    uint8_t buffer[FUEL_GAUGE_THRESHOLDS_SIZE];
+    FuelGaugeRequest request;
+
+    PutThresholdWord(buffer, FUEL_GAUGE_REG_VOLT_HI_SET_TH, thresholds->voltageHighSet);
+    PutThresholdWord(buffer, FUEL_GAUGE_REG_VOLT_HI_CLR_TH, thresholds->voltageHighClear);
+    PutThresholdWord(buffer, FUEL_GAUGE_REG_VOLT_LO_SET_TH, thresholds->voltageLowSet);
+    PutThresholdWord(buffer, FUEL_GAUGE_REG_VOLT_LO_CLR_TH, thresholds->voltageLowClear);
+    buffer[FUEL_GAUGE_REG_TEMP_HI_SET_TH - FUEL_GAUGE_REG_VOLT_HI_SET_TH] = (uint8_t) thresholds->temperatureHighSet;
+    buffer[FUEL_GAUGE_REG_TEMP_HI_CLR_TH - FUEL_GAUGE_REG_VOLT_HI_SET_TH] = (uint8_t) thresholds->temperatureHighClear;
+    buffer[FUEL_GAUGE_REG_TEMP_LO_SET_TH - FUEL_GAUGE_REG_VOLT_HI_SET_TH] = (uint8_t) thresholds->temperatureLowSet;
+    buffer[FUEL_GAUGE_REG_TEMP_LO_CLR_TH - FUEL_GAUGE_REG_VOLT_HI_SET_TH] = (uint8_t) thresholds->temperatureLowClear;
+
+    FuelGaugeRequestInitWrite(&request, FUEL_GAUGE_REG_VOLT_HI_SET_TH, buffer, sizeof(buffer));
+
+    return RunRequestOnBus(device, &request);
+}
+
+/**
+* \brief Reads the voltage and temperature thresholds in one transfer.
+*/
+bool FuelGaugeDevGetThresholds(FuelGaugeDevice *device, FuelGaugeThresholds *thresholds)
+{
+    configASSERT(thresholds != NULL);
+
+    uint8_t buffer[FUEL_GAUGE_THRESHOLDS_SIZE];
+    FuelGaugeRequest request;
+
+    FuelGaugeRequestInitRead(&request, FUEL_GAUGE_REG_VOLT_HI_SET_TH, buffer, sizeof(buffer));
+
+    if (RunRequestOnBus(device, &request) == false)
+        return false;
+
+    thresholds->voltageHighSet = GetThresholdWord(buffer, FUEL_GAUGE_REG_VOLT_HI_SET_TH);
+    thresholds->voltageHighClear = GetThresholdWord(buffer, FUEL_GAUGE_REG_VOLT_HI_CLR_TH);
+    thresholds->voltageLowSet = GetThresholdWord(buffer, FUEL_GAUGE_REG_VOLT_LO_SET_TH);
+    thresholds->voltageLowClear = GetThresholdWord(buffer, FUEL_GAUGE_REG_VOLT_LO_CLR_TH);
+    thresholds->temperatureHighSet = (int8_t) buffer[FUEL_GAUGE_REG_TEMP_HI_SET_TH - FUEL_GAUGE_REG_VOLT_HI_SET_TH];
+    thresholds->temperatureHighClear = (int8_t) buffer[FUEL_GAUGE_REG_TEMP_HI_CLR_TH - FUEL_GAUGE_REG_VOLT_HI_SET_TH];
+    thresholds->temperatureLowSet = (int8_t) buffer[FUEL_GAUGE_REG_TEMP_LO_SET_TH - FUEL_GAUGE_REG_VOLT_HI_SET_TH];
+    thresholds->temperatureLowClear = (int8_t) buffer[FUEL_GAUGE_REG_TEMP_LO_CLR_TH - FUEL_GAUGE_REG_VOLT_HI_SET_TH];
+
+    return true;
+}
+
+/**
+* \brief Notes a raised interrupt pin, safe from interrupt context.
+*/
+void FuelGaugeDevInterruptNotify(FuelGaugeDevice *device)
+{
+    device->interruptPending = true;
+}
+
+/**
+* \brief Reads InterruptStatus only if an interrupt is pending.
+*/
+bool FuelGaugeDevInterruptService(FuelGaugeDevice *device, uint8_t *status)
+{
+    configASSERT(status != NULL);
+
+    FuelGaugeRequest request;
+
+    (*status) = 0;
+
+    if (device->interruptPending == false)
+        return true;
+
+    // cleared before the read so a pin raised meanwhile is serviced next time
+    device->interruptPending = false;
+
+    FuelGaugeRequestInitRead(&request, FUEL_GAUGE_REG_INTERRUPT_STATUS, status, sizeof(uint8_t));
+
+    if (RunRequestOnBus(device, &request) == false) {
+        device->interruptPending = true;
+        (*status) = 0;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+* \brief Empties a data flash batch.
+*/
+void FuelGaugeDataFlashBatchInit(FuelGaugeDataFlashBatch *batch)
+{
+    configASSERT(batch != NULL);
+
+    memset(batch, 0, sizeof(*batch));
+}
+
+/**
+* \brief Adds a data flash edit to a batch.
+*/
+bool FuelGaugeDataFlashBatchSet(FuelGaugeDataFlashBatch *batch, uint16_t address, const uint8_t *data, uint16_t size)
+{
+    configASSERT(batch != NULL);
+    configASSERT(data != NULL || size == 0);
+
+    uint8_t missing = 0;
+
+    // a range the commit could not write is rejected here, before any block of the batch is written
+    if (IsDataFlashRange(address, size) == false)
+        return false;
+
+    // check for room first so a rejected edit leaves the batch as it was
+    for (uint32_t blockAddress = address & ~(FUEL_GAUGE_DF_BLOCK_SIZE - 1);
+         blockAddress < (uint32_t) address + size;
+         blockAddress += FUEL_GAUGE_DF_BLOCK_SIZE) {
+        if (FindBatchBlock(batch, blockAddress) == NULL)
+            missing++;
+    }
+
+    if (batch->count + missing > FUEL_GAUGE_DF_BATCH_BLOCKS)
+        return false;
+
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t byteAddress = address + i;
+        uint16_t blockAddress = byteAddress & ~(FUEL_GAUGE_DF_BLOCK_SIZE - 1);
+        uint8_t offset = byteAddress - blockAddress;
+        FuelGaugeDataFlashBatchBlock *block = FindBatchBlock(batch, blockAddress);
+
+        if (block == NULL) {
+            block = &batch->blocks[batch->count++];
+            block->address = blockAddress;
+            block->edited = 0;
+        }
+
+        block->data[offset] = data[i];
+        block->edited |= (1UL << offset);
+    }
+
+    return true;
+}
+
+/**
+* \brief Writes each block of a batch once and verifies it with one readback.
+*/
+FuelGaugeConfigError FuelGaugeDevDataFlashBatchCommit(FuelGaugeDevice *device, FuelGaugeDataFlashBatch *batch)
+{
+    configASSERT(batch != NULL);
+
+    FuelGaugeConfigError error = ERROR_NONE;
+    uint8_t first;
+    uint8_t last;
+
+    if (FuelGaugeDevBeginSession(device) == false)
+        return ERROR_WRITE;
+
+    // fill the unedited bytes inside each span before any write drops the data flash cache
+    for (uint8_t i = 0; i < batch->count && error == ERROR_NONE; i++) {
+        FuelGaugeDataFlashBatchBlock *block = &batch->blocks[i];
+        uint32_t span;
+
+        GetBatchSpan(block, &first, &last);
+        span = (0xFFFFFFFFUL >> (31 - last + first)) << first;
+
+        if ((block->edited & span) == span)
+            continue;
+
+        const uint8_t *current = GetDataFlashBlock(device, block->address);
+
+        if (current == NULL) {
+            error = ERROR_READ;
+            break;
+        }
+
+        for (uint8_t offset = first; offset <= last; offset++) {
+            if ((block->edited & (1UL << offset)) == 0)
+                block->data[offset] = current[offset];
+        }
+    }
+
+    for (uint8_t i = 0; i < batch->count && error == ERROR_NONE; i++) {
+        FuelGaugeDataFlashBatchBlock *block = &batch->blocks[i];
+
+        GetBatchSpan(block, &first, &last);
+
+        const Block chunk = {&block->data[first], block->address + first, last - first + 1};
+
+        if (WriteDataFlashChunk(device, &chunk) == false)
+            error = ERROR_WRITE;
+    }
+
+    // the writes dropped the cached blocks, so these reads come from the gauge
+    for (uint8_t i = 0; i < batch->count && error == ERROR_NONE; i++) {
+        FuelGaugeDataFlashBatchBlock *block = &batch->blocks[i];
+        const uint8_t *written = GetDataFlashBlock(device, block->address);
+
+        GetBatchSpan(block, &first, &last);
+
+        if (written == NULL)
+            error = ERROR_READ;
+        else if (memcmp(&written[first], &block->data[first], last - first + 1) != 0)
+            error = ERROR_MEMCMP;
+    }
+
+    FuelGaugeDevEndSession(device);
+
+    if (error == ERROR_NONE)
+        FuelGaugeDataFlashBatchInit(batch);
+
+    return error;
+}
+
+/**
+* \brief Gets current from the BQ27Z561.
+*/
+bool FuelGaugeDevGetCurrent(FuelGaugeDevice *device, int16_t *current)
+{
+    return GetCommon(device, FUEL_GAUGE_REG_CURRENT, (uint16_t *) current);
+}
+
+/**
+* \brief Gets remaining battery capacity from the BQ27Z561.
+*/
+bool FuelGaugeDevGetRemainingCapacity(FuelGaugeDevice *device, uint16_t *capacity)
+{
+    return GetCommon(device, FUEL_GAUGE_REG_REMAINING_CAP, capacity);
+}
+
+/**
+* \brief Gets predicted fully-charged battery capacity from the BQ27Z561.
+*/
+bool FuelGaugeDevGetFullChargeCapacity(FuelGaugeDevice *device, uint16_t *capacity)
+{
+    return GetCommon(device, FUEL_GAUGE_REG_FULL_CAP, capacity);
+}
+
+/**
+* \brief Gets relative state-of-charge (SoC) as % from the BQ27Z561.
+*/
+bool FuelGaugeDevGetRelativeSoc(FuelGaugeDevice *device, uint16_t *soc)
+{
+    return GetCommon(device, FUEL_GAUGE_REG_RELATIVE_SOC, soc);
+}
+
+/**
+* \brief Gets the state-of-health (SoH) information of the battery in
+*   percentage of Design Capacity from the BQ27Z561.
+*/
+bool FuelGaugeDevGetSoh(FuelGaugeDevice *device, uint16_t *soh)
+{
+    return GetCommon(device, FUEL_GAUGE_REG_RELATIVE_SOH, soh);
+}
+
+/**
+* \brief Gets design capacity for the BQ27Z561.
+*/
+bool FuelGaugeDevGetCapacity(FuelGaugeDevice *device, uint16_t *capacity)
+{
+    return GetCommon(device, FUEL_GAUGE_REG_DESIGN_CAP, capacity);
+}
+
+/**
+* \brief Enable the Impedance Tracking algorithm on the BQ27Z561.
+*/
+bool FuelGaugeDevEnableImpedanceTracking(FuelGaugeDevice *device)
+{
+    if (IsImpedanceTrackingEnabled(device) == true) // IT already enabled
+        return true;
+
+    WriteFlashBlockSafe(device, device->address,
+                        FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                        enableImpedanceTrackingCommand,
+                        sizeof(enableImpedanceTrackingCommand));
+
+    return IsImpedanceTrackingEnabled(device);
+}
+
+/**
+* \brief Disable the Impedance Tracking algorithm on the BQ27Z561.
+*/
+bool FuelGaugeDevDisableImpedanceTracking(FuelGaugeDevice *device)
+{
+    if (IsImpedanceTrackingEnabled(device) == true) {
+        WriteFlashBlockSafe(device, device->address,
+                            FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                            disableImpedanceTrackingCommand,
+                            sizeof(disableImpedanceTrackingCommand));
+    }
+
+    return IsImpedanceTrackingEnabled(device);
+}
+
+/**
+* \brief Enable the Lifetime Tracking algorithm on the BQ27Z561.
+*/
+bool FuelGaugeDevEnableLifetimeTracking(FuelGaugeDevice *device)
+{
+    if (IsLifetimeTrackingEnabled(device) == true) // Lifetime already enabled
+        return true;
+
+    WriteFlashBlockSafe(device, device->address,
+                        FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                        lifetimeTrackingCommand,
+                        sizeof(lifetimeTrackingCommand));
+
+    return IsLifetimeTrackingEnabled(device);
+}
+
+/**
+* \brief Disable the Lifetime Tracking algorithm on the BQ27Z561.
+*/
+bool FuelGaugeDevDisableLifetimeTracking(FuelGaugeDevice *device)
+{
+    if (IsImpedanceTrackingEnabled(device) == true) {
+        WriteFlashBlockSafe(device, device->address,
+                            FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                            lifetimeTrackingCommand,
+                            sizeof(lifetimeTrackingCommand));
+    }
+
+    return IsLifetimeTrackingEnabled(device);
+}
+
+/**
+* \brief Resets the BQ27Z561.
+*/
+bool FuelGaugeDevReset(FuelGaugeDevice *device)
+{
+    bool result = WriteFlashBlockSafe(device, device->address,
+                                      FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                                      resetCommand,
+                                      sizeof(resetCommand));
+
+    return result;
+}
+
+/**
+* \brief Unseals the BQ27Z561.
+*/
+bool FuelGaugeDevUnseal(FuelGaugeDevice *device)
+{
+    configASSERT(device->twi != NULL);
+
+    uint8_t keyFirstWord[] = {unsealKey[0], unsealKey[1]};
+    uint8_t keySecondWord[] = {unsealKey[2], unsealKey[3]};
+
+    bool result = false;
+
+    if (OpenBus(device, device->speed) == true) {
+        result = WriteFlashBlock(device, FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                                 keyFirstWord,
+                                 ARRAY_COUNT(keyFirstWord));
+
+        result &= WriteFlashBlock(device, FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                                  keySecondWord,
+                                  ARRAY_COUNT(keySecondWord));
+
+        CloseBus(device);
+    }
+
+    return result;
+}
+
+/**
+* \brief Gives full access to the BQ27Z561.
+*/
+bool FuelGaugeDevFullAccess(FuelGaugeDevice *device)
+{
+    configASSERT(device->twi != NULL);
+    
+    uint8_t keyFirstWord[] = {fullAccessKey[0], fullAccessKey[1]};
+    uint8_t keySecondWord[] = {fullAccessKey[2], fullAccessKey[3]};
+
+    bool result = false;
+
+    if (OpenBus(device, device->speed) == true) {
+        result = WriteFlashBlock(device, FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                                 keyFirstWord,
+                                 ARRAY_COUNT(keyFirstWord));
+
+        result &= WriteFlashBlock(device, FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                                  keySecondWord,
+                                  ARRAY_COUNT(keySecondWord));
+
+        CloseBus(device);
+    }
+
+    return result;
+}
+
+/**
+* \brief Seals the BQ27Z561.
+*/
+bool FuelGaugeDevSeal(FuelGaugeDevice *device)
+{
+    return WriteFlashBlockSafe(device, device->address,
+                               FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                               sealCommand,
+                               sizeof(sealCommand));
+}
+
+/**
+* \brief Resets lifetime history of battery BQ27Z561.
+*/
+bool FuelGaugeDevResetLifetimeHistory(FuelGaugeDevice *device)
+{
+    return WriteFlashBlockSafe(device, device->address,
+                               FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                               resetLifetimeCmd,
+                               sizeof(resetLifetimeCmd));
+}
+
+/**
+* \brief Send return-to-firmware command if BQ27Z561 is in ROM mode.
+*/
+bool FuelGaugeDevExitRomMode(FuelGaugeDevice *device)
+{
+    configASSERT(device->twi != NULL);
+
+    FuelGaugeRequest request;
+    bool result = false;
+
+    FuelGaugeRequestInitWrite(&request, FUEL_GAUGE_REG_ALT_MNFG_ACCESS, exitRomCmd, sizeof(exitRomCmd));
+    request.address = device->romAddress;
+
+    // a session keeps its own speed, OpenBus() only opens for lone calls
+    if (OpenBus(device, TWI_400KHZ) == true) {
+        result = RunRequest(device, &request);
+        CloseBus(device);
+    }
+
+    if (result == true)
+        device->romMode = false;
+
+    return result;
 }
 
 /**
 * \brief Execute a flash stream file onto BQ27Z561.
 */
-FuelGaugeConfigError FuelGaugeExecuteGoldenImage(void)
+FuelGaugeConfigError FuelGaugeDevExecuteGoldenImage(FuelGaugeDevice *device)
 {
-    configASSERT(Twi != NULL);
-
-    uint16_t length = strlen(goldenImage);
-    char buf[16];
-    uint16_t index = 0;
-
-    while (index < length) {
-        switch (goldenImage[index]) {
-            // writing/reading fuel gauge
-            case 'W':
-            case 'C': {
-                bool writeCmd = (goldenImage[index++] == 'W');
-
-                if (goldenImage[index++] != ':')
-                    return ERROR_COLON;
-
-                uint16_t byteNum = 1;
-                uint8_t data[34];
-                uint8_t fgAddress = 0;
-                unsigned char fgRegister = 0;
-
-                while ((length - index > 2) && (byteNum < sizeof(data) + 3) && (goldenImage[index] != '\n')) {
-                    // copy two values from file
-                    buf[0] = goldenImage[index++];
-                    buf[1] = goldenImage[index++];
-                    // set zero-terminated
-                    buf[2] = 0;
-                    // convert string to hex
-                    char *pError;
-                    uint8_t convertedData = strtoul(buf, &pError, 16);
-
-                    // check if conversion was successful
-                    if (*pError)
-                        return ERROR_CONV;
-
-                    // handle address
-                    if (byteNum == 1)
-                        fgAddress = convertedData;
-
-                    // set register
-                    if (byteNum == 2)
-                        fgRegister = convertedData;
-
-                    // construct data from file
-                    if (byteNum > 2)
-                        data[byteNum - 3] = convertedData;
-
-                    byteNum++;
-                }
+    FuelGaugeImageMemory memory = {
+        .text = goldenImage,
+        .size = sizeof(goldenImage) - 1,
+    };
+    FuelGaugeImageReader reader = {
+        .read = FuelGaugeImageMemoryRead,
+        .rewind = FuelGaugeImageMemoryRewind,
+        .context = &memory,
+    };
+
+    return FuelGaugeDevExecuteGoldenImageStream(device, &reader);
+}
+
+/**
+* \brief Execute a flash stream pulled through a reader onto BQ27Z561.
+*/
+FuelGaugeConfigError FuelGaugeDevExecuteGoldenImageStream(FuelGaugeDevice *device,
+                                                          const FuelGaugeImageReader *reader)
+{
+    ImageRun run = {
+        .device = device,
+    };
+
+    return ExecuteImageStream(&run, reader);
+}
+
+/**
+* \brief Execute a flash stream onto BQ27Z561, skipping ROM mode when data
+*   flash already holds every row of the image.
+*/
+FuelGaugeConfigError FuelGaugeDevExecuteGoldenImageIncremental(FuelGaugeDevice *device,
+                                                               const FuelGaugeImageReader *reader,
+                                                               FuelGaugeImageStats *stats)
+{
+    configASSERT(reader != NULL && reader->rewind != NULL);
+
+    ImageRun run = {
+        .device = device,
+        .incremental = true,
+        .scanning = true,
+        .rowsMatch = true,
+    };
+
+    // first pass: compare the rows with the gauge while it still runs firmware
+    FuelGaugeConfigError error = ExecuteImageStream(&run, reader);
+
+    if (error != ERROR_NONE)
+        return error;
+
+    // ROM mode erases all of data flash before the rows are written, so it
+    // is left out only when there is nothing to write
+    bool unchanged = (run.rows > 0 && run.rowsMatch == true);
+
+    if (stats != NULL) {
+        stats->blocksWritten = (unchanged == true) ? 0 : run.rows;
+        stats->blocksSkipped = (unchanged == true) ? run.rows : 0;
+    }
+
+    if (reader->rewind(reader->context) == false)
+        return ERROR_READ;
+
+    run.scanning = false;
+    run.incremental = unchanged;
+
+    return ExecuteImageStream(&run, reader);
+}
+
+/**
+* \brief Reader over a flash stream held in memory.
+*/
+int32_t FuelGaugeImageMemoryRead(void *context, uint8_t *buffer, uint32_t size)
+{
+    FuelGaugeImageMemory *memory = context;
+    uint32_t remaining = memory->size - memory->position;
+
+    if (size > remaining)
+        size = remaining;
+
+    memcpy(buffer, &memory->text[memory->position], size);
+    memory->position += size;
+
+    return size;
+}
+
+/**
+* \brief Restarts a flash stream held in memory.
+*/
+bool FuelGaugeImageMemoryRewind(void *context)
+{
+    FuelGaugeImageMemory *memory = context;
+
+    memory->position = 0;
+
+    return true;
+}
+
+/**
+* \brief Execute a flash stream compiled by tools/GoldenImageCompiler onto BQ27Z561.
+*/
+FuelGaugeConfigError FuelGaugeDevExecuteGoldenImageBinary(FuelGaugeDevice *device,
+                                                          const uint8_t *image,
+                                                          uint32_t size)
+{
+    configASSERT(device->twi != NULL);
+    configASSERT(image != NULL);
+
+    ImageRun run = {
+        .device = device,
+    };
+    uint32_t index = 0;
+
+    while (index < size) {
+        uint8_t opcode = image[index++];
+
+        switch (opcode) {
+            case FUEL_GAUGE_IMAGE_OP_WRITE:
+            case FUEL_GAUGE_IMAGE_OP_COMPARE: {
+                if (size - index < FUEL_GAUGE_IMAGE_RECORD_HEADER)
+                    return ERROR_COUNT;
+
+                uint8_t fgAddress = image[index++];
+                uint8_t fgRegister = image[index++];
+                uint8_t dataLength = image[index++];
+
+                if (dataLength == 0 || size - index < dataLength)
+                    return ERROR_COUNT;
+
+                FuelGaugeConfigError error = ExecuteImageRecord(&run,
+                                                                (opcode == FUEL_GAUGE_IMAGE_OP_WRITE),
+                                                                fgAddress,
+                                                                fgRegister,
+                                                                &image[index],
+                                                                dataLength);
+
+                if (error != ERROR_NONE)
+                    return error;
+
+                index += dataLength;
+                break;
+            }
+
+            case FUEL_GAUGE_IMAGE_OP_DELAY: {
+                if (size - index < FUEL_GAUGE_IMAGE_DELAY_SIZE)
+                    return ERROR_COUNT;
+
+                uint16_t delay = ((image[index + 1] << 8) | image[index]);
+                index += FUEL_GAUGE_IMAGE_DELAY_SIZE;
+                HoldBus(device, delay * 1000UL);
+
+                break;
+            }
+
+            default:
+                return ERROR_DEFAULT;
+        }
+    }
+
+    return ERROR_NONE;
+}
+
+/***********************************************************************
+   Static functions.
+***********************************************************************/
+// Runs a single request in its own bus open/close
+static inline bool RunRequestOnBus(FuelGaugeDevice *device,
+                                   FuelGaugeRequest *request)
+{
+    bool result = false;
+
+    if (OpenBus(device, device->speed) == true) {
+        result = RunRequest(device, request);
+        CloseBus(device);
+    }
+
+    return result;
+}
+
+static inline void PutThresholdWord(uint8_t *buffer,
+                                    const uint8_t registerAddress,
+                                    uint16_t value)
+{
+    buffer[registerAddress - FUEL_GAUGE_REG_VOLT_HI_SET_TH] = (uint8_t) value;
+    buffer[registerAddress - FUEL_GAUGE_REG_VOLT_HI_SET_TH + 1] = (uint8_t) (value >> 8);
+}
+
+static inline uint16_t GetThresholdWord(const uint8_t *buffer,
+                                        const uint8_t registerAddress)
+{
+    return GetWord(buffer, registerAddress - FUEL_GAUGE_REG_VOLT_HI_SET_TH);
+}
+
+static inline bool GetCommon(FuelGaugeDevice *device,
+                             const uint8_t registerAddress,
+                             uint16_t *value)
+{
+    configASSERT(device->twi != NULL);
+    configASSERT(registerAddress < FUEL_GAUGE_STANDARD_REG_COUNT);
+
+    FuelGaugeStandardCacheEntry *entry = &device->standardCache[registerAddress / sizeof(uint16_t)];
+
+    if (entry->valid == true && IsCacheFresh(device, FUEL_GAUGE_CACHE_STANDARD, entry->timestamp) == true) {
+        device->cacheStats.hits[FUEL_GAUGE_CACHE_STANDARD]++;
+        (*value) = entry->value;
+        return true;
+    }
+
+    FuelGaugeRequest request;
+    bool result = false;
+
+    FuelGaugeRequestInitRead(&request, registerAddress, (uint8_t *) value, sizeof(uint16_t));
+
+    if (OpenBus(device, device->speed) == true) {
+        result = RunRequest(device, &request);
+        CloseBus(device);
+    }
+
+    if (device->cacheEnabled == true) {
+        device->cacheStats.misses[FUEL_GAUGE_CACHE_STANDARD]++;
+
+        if (result == true)
+            CacheStandard(device, registerAddress, (*value));
+    }
+
+    return result;
+}
+
+// Keeps the bus idle for at least holdUs from now, extending any pending hold
+static inline void HoldBus(FuelGaugeDevice *device,
+                           const uint32_t holdUs)
+{
+    if (device->clock == NULL)
+        return;
+
+    uint32_t notBefore = device->clock->getTimeUs() + holdUs;
+
+    // signed differences keep the comparison correct across clock wrap-around
+    if (device->busHeld == false || (int32_t) (notBefore - device->busFreeUs) > 0)
+        device->busFreeUs = notBefore;
+
+    device->busHeld = true;
+}
+
+static inline bool IsBusHeld(FuelGaugeDevice *device)
+{
+    if (device->busHeld == false)
+        return false;
+
+    if ((int32_t) (device->busFreeUs - device->clock->getTimeUs()) > 0)
+        return true;
+
+    device->busHeld = false;
+
+    return false;
+}
+
+// Waits only for what is left of the hold placed by the previous transaction
+static inline void WaitForBus(FuelGaugeDevice *device)
+{
+    if (device->busHeld == false)
+        return;
+
+    int32_t remaining = (int32_t) (device->busFreeUs - device->clock->getTimeUs());
+
+    if (remaining > 0)
+        device->clock->delayUs(remaining);
+
+    device->busHeld = false;
+}
+
+// Inside a session the bus is already open, so only open/close it for lone calls
+static inline bool TryOpenBus(FuelGaugeDevice *device,
+                              TwiSpeed speed)
+{
+    configASSERT(device->twi != NULL);
+
+    if (device->sessionDepth > 0 || device->twi->open(speed) == true)
+        return true;
+
+    CountOpenFailure(device);
+
+    return false;
+}
+
+// Blocking callers wait out the backoff between open attempts
+static inline bool OpenBus(FuelGaugeDevice *device,
+                           TwiSpeed speed)
+{
+    uint8_t attempts = 0;
+
+    // blocking transfers would interleave with the request engine's
+    configASSERT(device->queueHead == NULL);
+
+    while (TryOpenBus(device, speed) == false) {
+        if (ScheduleRetry(device, &attempts, FUEL_GAUGE_ERROR_OPEN) == false) {
+            RecordResult(device, FUEL_GAUGE_ERROR_OPEN);
+            return false;
+        }
+
+        WaitForBus(device);
+    }
+
+    return true;
+}
+
+static inline void CloseBus(FuelGaugeDevice *device)
+{
+    configASSERT(device->twi != NULL);
+
+    if (device->sessionDepth == 0)
+        device->twi->close();
+}
+
+static inline bool IsCacheFresh(FuelGaugeDevice *device,
+                                FuelGaugeCacheClass cacheClass,
+                                uint32_t timestamp)
+{
+    if (device->cacheEnabled == false)
+        return false;
+
+    // unsigned subtraction keeps the age correct across clock wrap-around
+    return ((device->cacheConfig.getTimeMs() - timestamp) < device->cacheConfig.ttlMs[cacheClass]);
+}
+
+static inline void CacheStandard(FuelGaugeDevice *device,
+                                 const uint8_t registerAddress,
+                                 uint16_t value)
+{
+    if (device->cacheEnabled == false)
+        return;
+
+    FuelGaugeStandardCacheEntry *entry = &device->standardCache[registerAddress / sizeof(uint16_t)];
+
+    entry->valid = true;
+    entry->timestamp = device->cacheConfig.getTimeMs();
+    entry->value = value;
+}
+
+static inline FuelGaugeMacCacheEntry *FindMacCache(FuelGaugeDevice *device,
+                                                   const uint8_t registerAddress,
+                                                   const uint8_t *cmd,
+                                                   const uint8_t sizeOfCmd,
+                                                   const uint8_t sizeOfData)
+{
+    if (device->cacheEnabled == false)
+        return NULL;
+
+    for (uint8_t i = 0; i < FUEL_GAUGE_CACHE_MAC_ENTRIES; i++) {
+        FuelGaugeMacCacheEntry *entry = &device->macCache[i];
+
+        if (entry->valid == true
+            && entry->registerAddress == registerAddress
+            && entry->sizeOfCmd == sizeOfCmd
+            && entry->sizeOfData == sizeOfData
+            && memcmp(entry->cmd, cmd, sizeOfCmd) == 0)
+            return entry;
+    }
+
+    return NULL;
+}
+
+static inline uint8_t GetImageAddress(FuelGaugeDevice *device,
+                                      const uint8_t imageAddress)
+{
+    uint8_t address = (imageAddress >> 1);
+
+    if (address == FUEL_GAUGE_I2C_ADDRESS)
+        return device->address;
+
+    if (address == FUEL_GAUGE_ROM_I2C_ADDRESS)
+        return device->romAddress;
+
+    return address;
+}
+
+static inline FuelGaugeConfigError ExecuteImageStream(ImageRun *run,
+                                                      const FuelGaugeImageReader *reader)
+{
+    configASSERT(run->device->twi != NULL);
+    configASSERT(reader != NULL && reader->read != NULL);
+
+    ImageParser parser;
+    uint8_t chunk[FUEL_GAUGE_IMAGE_CHUNK_SIZE];
+    FuelGaugeConfigError error = ERROR_NONE;
+
+    ResetImageParser(&parser);
+
+    while (error == ERROR_NONE) {
+        int32_t count = reader->read(reader->context, chunk, sizeof(chunk));
+
+        if (count < 0)
+            return ERROR_READ;
+
+        // a last line without newline still counts
+        if (count == 0)
+            return ParseImageChar(run, &parser, '\n');
+
+        for (int32_t i = 0; (i < count) && (error == ERROR_NONE); i++)
+            error = ParseImageChar(run, &parser, chunk[i]);
+    }
+
+    return error;
+}
+
+// Runs one W: (write) or C: (read and compare) line of a flash stream
+static inline FuelGaugeConfigError ExecuteImageRecord(ImageRun *run,
+                                                      const bool writeCmd,
+                                                      const uint8_t imageAddress,
+                                                      const uint8_t fgRegister,
+                                                      const uint8_t *data,
+                                                      const uint8_t dataLength)
+{
+    FuelGaugeDevice *device = run->device;
+    // the image uses 8-bit addresses of a gauge at the default addresses
+    uint8_t fgAddress = GetImageAddress(device, imageAddress);
+
+    // the first pass of an incremental run only reads data flash, once a
+    // row differs the rest need not be read anymore
+    if (run->scanning) {
+        if (writeCmd && IsDataFlashRowWrite(run, fgAddress, fgRegister, data, dataLength)) {
+            run->rows++;
+
+            if (run->rowsMatch == true)
+                run->rowsMatch = DataFlashRowMatches(run, data, dataLength);
+        }
+
+        return ERROR_NONE;
+    }
+
+    // an unchanged image leaves out ROM mode entry, erase, rows, checksum and exit
+    run->skippingRom = IsRomSessionRecord(run, writeCmd, fgAddress, fgRegister, data, dataLength);
+
+    if (run->skippingRom)
+        return ERROR_NONE;
+
+    if (writeCmd) {
+        // the data in the golden image file is in little endian format
+        if (WriteFlashBlockSafe(device, fgAddress, fgRegister, data, dataLength) == false)
+            return ERROR_WRITE;
+
+        if (IsRomEntryRecord(device, writeCmd, fgAddress, fgRegister, data, dataLength))
+            device->romMode = true;
+        else if (fgAddress == device->romAddress && fgRegister == FUEL_GAUGE_ROM_REG_EXIT)
+            device->romMode = false;
+    } else {
+        uint8_t dataFromGauge[dataLength];
+        bool result = false;
+
+        if (OpenBus(device, device->speed) == true) {
+            result = ReadFlashBlock(device, fgAddress, fgRegister, dataFromGauge, dataLength);
+            CloseBus(device);
+        }
 
-                if (byteNum < 4)
-                    return ERROR_COUNT;
+        // data that could not be read back does not match
+        if (result == false || memcmp(data, dataFromGauge, dataLength))
+            return ERROR_MEMCMP;
+    }
 
-                uint8_t dataLength = byteNum - 3;
+    return ERROR_NONE;
+}
 
-                if (writeCmd) {
-                    // the data in the golden image file is in little endian format
-                    WriteFlashBlockSafe((fgAddress >> 1), fgRegister, data, dataLength);
-                } else {
-                    uint8_t dataFromGauge[dataLength];
+// ROM mode data flash writes carry count, address (little-endian) and count - 2 data bytes
+static inline bool IsDataFlashRowWrite(ImageRun *run,
+                                       const uint8_t fgAddress,
+                                       const uint8_t fgRegister,
+                                       const uint8_t *data,
+                                       const uint8_t dataLength)
+{
+    return ((run->incremental == true)
+            && (fgAddress == run->device->romAddress)
+            && (fgRegister == FUEL_GAUGE_ROM_REG_DF_WRITE)
+            && (dataLength > 3)
+            && (data[0] == dataLength - 1));
+}
 
-                    if (Twi->open(FUEL_GAUGE_TWI_SPEED) == true) {
-                        ReadFlashBlock((fgAddress >> 1), fgRegister, dataFromGauge, dataLength);
-                        Twi->close();
-                    }
+// Compares a ROM mode row write with data flash, read through MAC in 32-byte blocks
+static inline bool DataFlashRowMatches(ImageRun *run,
+                                       const uint8_t *data,
+                                       const uint8_t dataLength)
+{
+    uint16_t address = ((data[2] << 8) | data[1]);
+    uint16_t blockAddress = address & ~(FUEL_GAUGE_DF_BLOCK_SIZE - 1);
+    uint8_t offset = address - blockAddress;
+    uint8_t rowLength = dataLength - 3;
+
+    // rows spanning two blocks or outside data flash cannot be read back
+    if (offset + rowLength > FUEL_GAUGE_DF_BLOCK_SIZE || IsDataFlashRange(address, rowLength) == false)
+        return false;
+
+    if (run->blockValid == false || run->blockAddress != blockAddress) {
+        run->blockValid = ReadDataFlashBlock(run->device, blockAddress, run->block);
+        run->blockAddress = blockAddress;
+    }
 
-                    if (memcmp(data, dataFromGauge, dataLength))
-                        return ERROR_MEMCMP;
-                }
+    return (run->blockValid && (memcmp(&run->block[offset], &data[3], rowLength) == 0));
+}
 
-                break;
-            }
+// From the ROM mode entry command of an unchanged image up to the return to firmware
+static inline bool IsRomSessionRecord(ImageRun *run,
+                                      const bool writeCmd,
+                                      const uint8_t fgAddress,
+                                      const uint8_t fgRegister,
+                                      const uint8_t *data,
+                                      const uint8_t dataLength)
+{
+    if (run->incremental == false)
+        return false;
 
-            // handle delay
-            case 'X': {
-                index++;
+    if (fgAddress == run->device->romAddress)
+        return run->skippingRom;
 
-                if (goldenImage[index] != ':')
-                    return ERROR_COLON;
+    return IsRomEntryRecord(run->device, writeCmd, fgAddress, fgRegister, data, dataLength);
+}
 
-                index++;
-                uint8_t n = 0;
+static inline bool IsRomEntryRecord(FuelGaugeDevice *device,
+                                    const bool writeCmd,
+                                    const uint8_t fgAddress,
+                                    const uint8_t fgRegister,
+                                    const uint8_t *data,
+                                    const uint8_t dataLength)
+{
+    return (writeCmd
+            && (fgAddress == device->address)
+            && (fgRegister == FUEL_GAUGE_REG_CONTROL_STATUS)
+            && (dataLength == sizeof(enterRomCmd))
+            && (memcmp(data, enterRomCmd, sizeof(enterRomCmd)) == 0));
+}
 
-                while ((index < length) && (goldenImage[index] != '\n') && (n < sizeof(buf) - 1))
-                    buf[n++] = goldenImage[index++];
+// Reads one 32-byte data flash block through ManufacturerBlockAccess (gauge must be unsealed)
+static inline bool ReadDataFlashBlock(FuelGaugeDevice *device,
+                                      const uint16_t address,
+                                      uint8_t *block)
+{
+    const uint8_t cmd [] = {(uint8_t) address, (uint8_t) (address >> 8)};
+    uint8_t values[sizeof(cmd) + FUEL_GAUGE_DF_BLOCK_SIZE];
 
-                // set zero-terminated
-                buf[n] = 0;
-                n = atoi(buf);
-                //vTaskDelay(n);
+    bool result = PrimedReadOperation(device,
+                                      FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+                                      cmd,
+                                      sizeof(cmd),
+                                      values,
+                                      sizeof(values));
 
-                break;
-            }
+    // the response echoes the address it belongs to
+    if (result == false || memcmp(values, cmd, sizeof(cmd)) != 0)
+        return false;
 
-            default:
-                return ERROR_DEFAULT;
-        }
+    memcpy(block, &values[sizeof(cmd)], FUEL_GAUGE_DF_BLOCK_SIZE);
 
-        while ((index < length) && (goldenImage[index] != '\n'))
-            index++; //skip to next line
+    return true;
+}
 
-        if (index < length)
-            index++;
+static inline FuelGaugeDataFlashBatchBlock *FindBatchBlock(FuelGaugeDataFlashBatch *batch,
+                                                           const uint16_t address)
+{
+    for (uint8_t i = 0; i < batch->count; i++) {
+        if (batch->blocks[i].address == address)
+            return &batch->blocks[i];
     }
 
-    return ERROR_NONE;
+    return NULL;
 }
 
-/***********************************************************************
-   Static functions.
-***********************************************************************/
-static inline bool GetCommon(const uint8_t registerAddress,
-                             uint16_t *value)
+// First and last edited byte of a batch block, every block holds at least one edit
+static inline void GetBatchSpan(const FuelGaugeDataFlashBatchBlock *block,
+                                uint8_t *first,
+                                uint8_t *last)
 {
-    configASSERT(Twi != NULL);
+    (*first) = 0;
+    (*last) = FUEL_GAUGE_DF_BLOCK_SIZE - 1;
 
+    configASSERT(block->edited != 0);
+
+    while ((block->edited & (1UL << (*first))) == 0)
+        (*first)++;
+
+    while ((block->edited & (1UL << (*last))) == 0)
+        (*last)--;
+}
+
+// Serves an aligned data flash block from the cache, reading it on a miss
+static inline const uint8_t *GetDataFlashBlock(FuelGaugeDevice *device,
+                                               const uint16_t address)
+{
+    for (uint8_t i = 0; i < FUEL_GAUGE_DF_CACHE_BLOCKS; i++) {
+        FuelGaugeDataFlashCacheEntry *entry = &device->dataFlashCache[i];
+
+        if (entry->valid == true && entry->address == address)
+            return entry->data;
+    }
+
+    FuelGaugeDataFlashCacheEntry *entry = &device->dataFlashCache[device->dataFlashCacheNext];
+
+    device->dataFlashCacheNext = (device->dataFlashCacheNext + 1) % FUEL_GAUGE_DF_CACHE_BLOCKS;
+
+    entry->address = address;
+    entry->valid = ReadDataFlashBlock(device, address, entry->data);
+
+    return (entry->valid == true) ? entry->data : NULL;
+}
+
+// Writes up to one block: address and data to ManufacturerBlockAccess, then MacDataSum and MacDataLen to commit it
+static inline bool WriteDataFlashChunk(FuelGaugeDevice *device,
+                                       const Block *chunk)
+{
+    uint8_t payload[sizeof(uint16_t) + FUEL_GAUGE_DF_BLOCK_SIZE];
+    uint8_t sum = 0;
+    FuelGaugeRequest request;
     bool result = false;
 
-    if (Twi->open(FUEL_GAUGE_TWI_SPEED) == true) {
-        result = Twi->read(FUEL_GAUGE_I2C_ADDRESS, &registerAddress, sizeof(uint8_t), value,
-                             sizeof(uint16_t));
-        Twi->close();
-        // minimum 66-us delay required before next I2C transaction
-        //vTaskDelay(FUEL_GAUGE_I2C_DELAY);
+    configASSERT(chunk->size <= FUEL_GAUGE_DF_BLOCK_SIZE);
+
+    payload[0] = (uint8_t) chunk->startAddress;
+    payload[1] = (uint8_t) (chunk->startAddress >> 8);
+    memcpy(&payload[sizeof(uint16_t)], chunk->data, chunk->size);
+
+    for (uint8_t i = 0; i < sizeof(uint16_t) + chunk->size; i++)
+        sum += payload[i];
+
+    const uint8_t trailer [] = {(uint8_t) ~sum, (uint8_t) (sizeof(uint16_t) + chunk->size + 2)};
+
+    if (OpenBus(device, device->speed) == false)
+        return false;
+
+    FuelGaugeRequestInitWrite(&request, FUEL_GAUGE_REG_ALT_MNFG_ACCESS, payload, sizeof(uint16_t) + chunk->size);
+    result = RunRequest(device, &request);
+
+    if (result == true) {
+        FuelGaugeRequestInitWrite(&request, FUEL_GAUGE_REG_MAC_DATA_SUM, trailer, sizeof(trailer));
+        result = RunRequest(device, &request);
     }
 
+    CloseBus(device);
+
+    // the gauge programs the block before it answers again
+    if (result == true)
+        HoldBus(device, FUEL_GAUGE_DF_WRITE_US);
+
     return result;
 }
 
+static inline void ResetImageParser(ImageParser *parser)
+{
+    memset(parser, 0, sizeof(*parser));
+    parser->nibble = -1;
+}
+
+// Feeds one character of a flash stream, running each line once it is complete
+static inline FuelGaugeConfigError ParseImageChar(ImageRun *run,
+                                                  ImageParser *parser,
+                                                  const uint8_t c)
+{
+    if (c == '\n') {
+        FuelGaugeConfigError error = FinishImageLine(run, parser);
+        ResetImageParser(parser);
+        return error;
+    }
+
+    if (parser->comment == true || c == '\r' || c == ' ' || c == '\t')
+        return ERROR_NONE;
+
+    if (parser->op == 0) {
+        if (c == ';')
+            parser->comment = true;
+        else if (c == 'W' || c == 'C' || c == 'X')
+            parser->op = c;
+        else
+            return ERROR_DEFAULT;
+
+        return ERROR_NONE;
+    }
+
+    if (parser->colon == false) {
+        if (c != ':')
+            return ERROR_COLON;
+
+        parser->colon = true;
+        return ERROR_NONE;
+    }
+
+    if (parser->op == 'X') {
+        if (c < '0' || c > '9')
+            return ERROR_CONV;
+
+        // saturate while accumulating, a long digit string must not wrap to a short delay
+        parser->delay = (parser->delay * 10) + (c - '0');
+        if (parser->delay > FUEL_GAUGE_MAX_HOLD_MS)
+            parser->delay = FUEL_GAUGE_MAX_HOLD_MS;
+
+        parser->digits = true;
+        return ERROR_NONE;
+    }
+
+    int8_t value;
+
+    if (c >= '0' && c <= '9')
+        value = c - '0';
+    else if (c >= 'A' && c <= 'F')
+        value = c - 'A' + 10;
+    else if (c >= 'a' && c <= 'f')
+        value = c - 'a' + 10;
+    else
+        return ERROR_CONV;
+
+    if (parser->nibble < 0) {
+        parser->nibble = value;
+        return ERROR_NONE;
+    }
+
+    if (parser->byteCount == sizeof(parser->bytes))
+        return ERROR_LENGTH;
+
+    parser->bytes[parser->byteCount++] = (parser->nibble << 4) | value;
+    parser->nibble = -1;
+
+    return ERROR_NONE;
+}
+
+static inline FuelGaugeConfigError FinishImageLine(ImageRun *run,
+                                                   ImageParser *parser)
+{
+    // blank or comment line
+    if (parser->op == 0)
+        return ERROR_NONE;
+
+    if (parser->colon == false)
+        return ERROR_COLON;
+
+    if (parser->op == 'X') {
+        if (parser->digits == false)
+            return ERROR_CONV;
+
+        // delays of a ROM session that is left out are left out too
+        if (run->scanning == false && run->skippingRom == false) {
+            HoldBus(run->device, parser->delay * 1000UL);
+        }
+
+        return ERROR_NONE;
+    }
+
+    if (parser->nibble >= 0)
+        return ERROR_CONV;
+
+    // address, register and at least one data byte
+    if (parser->byteCount < 3)
+        return ERROR_COUNT;
+
+    return ExecuteImageRecord(run,
+                              (parser->op == 'W'),
+                              parser->bytes[0],
+                              parser->bytes[1],
+                              &parser->bytes[2],
+                              parser->byteCount - 2);
+}
+
+// standard registers are little-endian words
+static inline uint16_t GetWord(const uint8_t *buffer,
+                               const uint8_t registerAddress)
+{
+    return ((buffer[registerAddress + 1] << 8) | buffer[registerAddress]);
+}
+
+// values are stored with memcpy, they may be unaligned members of FuelGaugeDiagnostics
+static inline void DecodeMacU16(const uint8_t *data, uint8_t size, void *value)
+{
+    uint16_t word = ((data[1] << 8) | data[0]);
+
+    (void) size;
+
+    memcpy(value, &word, sizeof(word));
+}
+
+// upper byte is the temperature range, lower 2 bytes are the charging status flags
+static inline void DecodeMacSTATUS24(const uint8_t *data, uint8_t size, void *value)
+{
+    uint32_t status = (((uint32_t) data[0] << 16) | (data[2] << 8) | data[1]);
+
+    (void) size;
+
+    memcpy(value, &status, sizeof(status));
+}
+
+static inline void DecodeMacSTATUS32(const uint8_t *data, uint8_t size, void *value)
+{
+    uint32_t status = (((uint32_t) data[1] << 24) | ((uint32_t) data[0] << 16) | (data[3] << 8) | data[2]);
+
+    (void) size;
+
+    memcpy(value, &status, sizeof(status));
+}
+
+static inline void DecodeMacWORDS(const uint8_t *data, uint8_t size, void *value)
+{
+    uint8_t *words = value;
+
+    for (uint8_t i = 0; i < size / 2; i++)
+        DecodeMacU16(&data[2 * i], sizeof(uint16_t), &words[2 * i]);
+}
+
+static inline void DecodeMacBYTES(const uint8_t *data, uint8_t size, void *value)
+{
+    memcpy(value, data, size);
+}
+
 // We have the ability to read the keys, but I also hard-coded const declarations of both keys to simplify
-static inline void GetKey(FuelGaugeSecurityKey desiredKey, uint8_t *key)
+static inline void GetKey(FuelGaugeDevice *device,
+                          FuelGaugeSecurityKey desiredKey,
+                          uint8_t *key)
 {
     uint8_t values [] = {
         0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
     };
 
-    PrimedReadOperation(FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
+    PrimedReadOperation(device, FUEL_GAUGE_REG_ALT_MNFG_ACCESS,
                         securityKeysCmd,
                         sizeof(securityKeysCmd),
                         values,
@@ -627,103 +2507,456 @@ static inline void GetKey(FuelGaugeSecurityKey desiredKey, uint8_t *key)
     }
 }
 
-static inline bool PrimedReadOperation(const uint8_t registerAddress,
+static inline bool PrimedReadOperation(FuelGaugeDevice *device,
+                                       const uint8_t registerAddress,
                                        const uint8_t *cmd,
                                        const uint8_t sizeOfCmd,
                                        uint8_t *data,
                                        const uint8_t sizeOfData)
 {
-    configASSERT(Twi != NULL);
+    configASSERT(device->twi != NULL);
+
+    FuelGaugeMacCacheEntry *entry = FindMacCache(device, registerAddress, cmd, sizeOfCmd, sizeOfData);
+
+    if (entry != NULL && IsCacheFresh(device, FUEL_GAUGE_CACHE_MAC, entry->timestamp) == true) {
+        device->cacheStats.hits[FUEL_GAUGE_CACHE_MAC]++;
+        memcpy(data, entry->data, sizeOfData);
+        return true;
+    }
 
+    FuelGaugeRequest request;
     bool result = false;
 
-    if (Twi->open(FUEL_GAUGE_TWI_SPEED) == true) {
-        // Configure pointer to flash location
-        result = WriteFlashBlock(registerAddress, cmd, sizeOfCmd);
-        // Read from desired flash location
-        result &= ReadFlashBlock(FUEL_GAUGE_I2C_ADDRESS, registerAddress, data, sizeOfData);
+    // Configure pointer to flash location, then read from it
+    FuelGaugeRequestInitPrimedRead(&request, registerAddress, cmd, sizeOfCmd, data, sizeOfData);
+
+    if (OpenBus(device, device->speed) == true) {
+        result = RunRequest(device, &request);
+        CloseBus(device);
+    }
+
+    if (device->cacheEnabled == true) {
+        device->cacheStats.misses[FUEL_GAUGE_CACHE_MAC]++;
+
+        if (result == true
+            && sizeOfCmd <= FUEL_GAUGE_CACHE_MAC_CMD_SIZE
+            && sizeOfData <= FUEL_GAUGE_CACHE_MAC_DATA_SIZE) {
+            if (entry == NULL) {
+                entry = &device->macCache[device->macCacheNext];
+                device->macCacheNext = (device->macCacheNext + 1) % FUEL_GAUGE_CACHE_MAC_ENTRIES;
+            }
 
-        Twi->close();
+            entry->valid = true;
+            entry->timestamp = device->cacheConfig.getTimeMs();
+            entry->registerAddress = registerAddress;
+            memcpy(entry->cmd, cmd, sizeOfCmd);
+            entry->sizeOfCmd = sizeOfCmd;
+            memcpy(entry->data, data, sizeOfData);
+            entry->sizeOfData = sizeOfData;
+        }
     }
 
     return result;
 }
 
-static inline bool IsImpedanceTrackingEnabled(void)
+static inline bool IsImpedanceTrackingEnabled(FuelGaugeDevice *device)
 {
     uint16_t manfStatus;
-    FuelGaugeGetManufacturingStatus(&manfStatus);
+    FuelGaugeDevGetManufacturingStatus(device, &manfStatus);
 
     bool result = (BIT_IS_SET(manfStatus, FUEL_GAUGE_IT_ENABLED_BIT));
 
     return result;
 }
 
-static inline bool IsLifetimeTrackingEnabled(void)
+static inline bool IsLifetimeTrackingEnabled(FuelGaugeDevice *device)
 {
     uint16_t manfStatus;
-    FuelGaugeGetManufacturingStatus(&manfStatus);
+    FuelGaugeDevGetManufacturingStatus(device, &manfStatus);
 
     bool result = (BIT_IS_SET(manfStatus, FUEL_GAUGE_LF_ENABLED_BIT));
 
     return result;
 }
 
-static inline bool ReadFlashBlock(const uint8_t fgAddress,
+static inline bool ReadFlashBlock(FuelGaugeDevice *device,
+                                  const uint8_t fgAddress,
                                   const uint8_t registerAddress,
                                   uint8_t *value,
                                   const uint8_t size)
 {
-    configASSERT(Twi != NULL);
+    FuelGaugeRequest request;
 
-    bool result = Twi->read(fgAddress,
-                            &registerAddress,
-                            sizeof(uint8_t),
-                            value,
-                            size);
+    FuelGaugeRequestInitRead(&request, registerAddress, value, size);
+    request.address = fgAddress;
 
-    // vTaskDelay(FUEL_GAUGE_I2C_DELAY); // minimum 66-us delay required before next I2C transaction
-
-    return result;
+    return RunRequest(device, &request);
 }
 
-static inline bool WriteFlashBlock(const uint8_t registerAddress,
+static inline bool WriteFlashBlock(FuelGaugeDevice *device,
+                                   const uint8_t registerAddress,
                                    const uint8_t *value,
                                    const uint8_t size)
 {
-    configASSERT(Twi != NULL);
+    FuelGaugeRequest request;
 
-    bool result = Twi->write(FUEL_GAUGE_I2C_ADDRESS,
-                             &registerAddress,
-                             sizeof(uint8_t),
-                             value,
-                             size);
+    FuelGaugeRequestInitWrite(&request, registerAddress, value, size);
 
-    //vTaskDelay(FUEL_GAUGE_I2C_DELAY); // minimum 66-us delay required before next I2C transaction
-
-    return result;
+    return RunRequest(device, &request);
 }
 
-static inline bool WriteFlashBlockSafe(const uint8_t fgAddress,
+static inline bool WriteFlashBlockSafe(FuelGaugeDevice *device,
+                                       const uint8_t fgAddress,
                                        const uint8_t registerAddress,
                                        const uint8_t *value,
                                        const uint8_t size)
 {
-    configASSERT(Twi != NULL);
-
+    FuelGaugeRequest request;
     bool result = false;
 
-    if (Twi->open(FUEL_GAUGE_TWI_SPEED) == true) {
-        result = Twi->write(fgAddress,
-                            &registerAddress,
-                            sizeof(uint8_t),
-                            value,
-                            size);
+    FuelGaugeRequestInitWrite(&request, registerAddress, value, size);
+    request.address = fgAddress;
+
+    if (OpenBus(device, device->speed) == true) {
+        result = RunRequest(device, &request);
+        CloseBus(device);
+    }
+
+    return result;
+}
+
+// primed reads write the command, then read; a MAC response read runs from
+// 0x3E through MacDataSum and MacDataLen so that all of it can be checked
+static inline uint8_t GetRequestSteps(const FuelGaugeRequest *request)
+{
+    return (request->type == FUEL_GAUGE_REQUEST_PRIMED_READ) ? 2 : 1;
+}
+
+// the last step of a read request reads, every other step writes
+static inline bool IsReadStep(const FuelGaugeRequest *request)
+{
+    return ((request->type != FUEL_GAUGE_REQUEST_WRITE)
+            && (request->step == GetRequestSteps(request) - 1));
+}
+
+static inline bool IsMacRequest(const FuelGaugeRequest *request)
+{
+    return ((request->type == FUEL_GAUGE_REQUEST_PRIMED_READ)
+            && (request->registerAddress == FUEL_GAUGE_REG_ALT_MNFG_ACCESS));
+}
+
+// data flash addresses share ManufacturerBlockAccess with MAC commands
+static inline bool IsDataFlashRange(const uint16_t address,
+                                    const uint16_t size)
+{
+    return ((address >= FUEL_GAUGE_DF_START)
+            && ((uint32_t) address + size <= FUEL_GAUGE_DF_START + FUEL_GAUGE_DF_SIZE));
+}
+
+// the response read of a MAC command, checked before it is handed over
+static inline bool IsMacResponseStep(const FuelGaugeRequest *request)
+{
+    return ((IsMacRequest(request) == true) && (IsReadStep(request) == true));
+}
+
+// Picks register and buffer of the current step, returns true for a read
+static inline bool GetStepTransfer(FuelGaugeDevice *device,
+                                   FuelGaugeRequest *request,
+                                   const uint8_t **registerAddress,
+                                   uint8_t **buffer,
+                                   uint8_t *size)
+{
+    *registerAddress = &request->registerAddress;
+
+    if (IsMacResponseStep(request) == true) {
+        *buffer = device->macResponse;
+        *size = FUEL_GAUGE_MAC_RESPONSE_SIZE;
+        return true;
+    }
 
-        Twi->close();
+    if (IsReadStep(request) == true) {
+        *buffer = request->data;
+        *size = request->sizeOfData;
+        return true;
     }
 
-    //vTaskDelay(FUEL_GAUGE_I2C_DELAY); // minimum 66-us delay required before next I2C transaction
+    *buffer = (uint8_t *) request->cmd;
+    *size = request->sizeOfCmd;
+    return false;
+}
+
+// Checks what a completed step read, MacDataSum is the complement of the byte sum of command and data
+static inline FuelGaugeError CheckStep(FuelGaugeDevice *device,
+                                       FuelGaugeRequest *request)
+{
+    const uint8_t *response = device->macResponse;
+
+    if (IsMacResponseStep(request) == false)
+        return FUEL_GAUGE_ERROR_NONE;
+
+    uint8_t length = response[FUEL_GAUGE_REG_MAC_DATA_LEN - FUEL_GAUGE_REG_ALT_MNFG_ACCESS];
+
+    // only the length - 2 bytes covered by MacDataSum may be handed over
+    if (length < 4 || length > FUEL_GAUGE_MAC_RESPONSE_SIZE || request->sizeOfData > length - 2)
+        return FUEL_GAUGE_ERROR_CHECKSUM;
+
+    uint8_t sum = 0;
+
+    for (uint8_t i = 0; i < length - 2; i++)
+        sum += response[i];
+
+    sum = ~sum;
+
+    if (sum != response[FUEL_GAUGE_REG_MAC_DATA_SUM - FUEL_GAUGE_REG_ALT_MNFG_ACCESS])
+        return FUEL_GAUGE_ERROR_CHECKSUM;
+
+    memcpy(request->data, response, request->sizeOfData);
+
+    return FUEL_GAUGE_ERROR_NONE;
+}
+
+static inline uint8_t GetRequestAddress(FuelGaugeDevice *device,
+                                        const FuelGaugeRequest *request)
+{
+    return (request->address != 0) ? request->address : device->address;
+}
+
+static inline FuelGaugeError TransferStep(FuelGaugeDevice *device,
+                                          FuelGaugeRequest *request)
+{
+    configASSERT(device->twi != NULL);
+
+    uint8_t address = GetRequestAddress(device, request);
+    const uint8_t *registerAddress;
+    uint8_t *buffer;
+    uint8_t size;
+    bool result;
+
+    WaitForBus(device);
+
+    if (GetStepTransfer(device, request, &registerAddress, &buffer, &size) == true)
+        result = device->twi->read(address, registerAddress, sizeof(uint8_t), buffer, size);
+    else
+        result = device->twi->write(address, registerAddress, sizeof(uint8_t), buffer, size);
+
+    // minimum 66-us delay required before next I2C transaction
+    HoldBus(device, FUEL_GAUGE_BUS_FREE_US);
+
+    if (result == false)
+        return FUEL_GAUGE_ERROR_TRANSFER;
+
+    return CheckStep(device, request);
+}
+
+static inline bool StartTransferStep(FuelGaugeDevice *device,
+                                     FuelGaugeRequest *request)
+{
+    configASSERT(device->twiAsync != NULL);
+
+    uint8_t address = GetRequestAddress(device, request);
+    const uint8_t *registerAddress;
+    uint8_t *buffer;
+    uint8_t size;
+    bool result;
+
+    device->transferPending = true;
+
+    if (GetStepTransfer(device, request, &registerAddress, &buffer, &size) == true)
+        result = device->twiAsync->startRead(address, registerAddress, sizeof(uint8_t), buffer, size);
+    else
+        result = device->twiAsync->startWrite(address, registerAddress, sizeof(uint8_t), buffer, size);
+
+    if (result == false)
+        device->transferPending = false;
 
     return result;
 }
+
+static inline void FinishRequest(FuelGaugeDevice *device,
+                                 FuelGaugeRequest *request,
+                                 FuelGaugeError error)
+{
+    // any write may change what the gauge reports, even a failed one
+    if (request->type == FUEL_GAUGE_REQUEST_WRITE)
+        FuelGaugeDevCacheInvalidate(device);
+
+    CountRequestEnd(device, request, error == FUEL_GAUGE_ERROR_NONE);
+    RecordResult(device, error);
+
+    request->error = error;
+    request->state = (error == FUEL_GAUGE_ERROR_NONE) ? FUEL_GAUGE_REQUEST_DONE : FUEL_GAUGE_REQUEST_FAILED;
+}
+
+// Runs every step of a request back to back on an already open bus
+static inline bool RunRequest(FuelGaugeDevice *device,
+                              FuelGaugeRequest *request)
+{
+    FuelGaugeError error = FUEL_GAUGE_ERROR_NONE;
+
+    request->state = FUEL_GAUGE_REQUEST_BUSY;
+
+    CountRequestStart(device, request);
+
+    request->step = 0;
+    request->attempts = 0;
+
+    while ((error == FUEL_GAUGE_ERROR_NONE) && (request->step < GetRequestSteps(request))) {
+        error = TransferStep(device, request);
+
+        if (error == FUEL_GAUGE_ERROR_NONE) {
+            request->step++;
+            request->attempts = 0;
+        } else if (RetryStep(device, request, error) == true) {
+            error = FUEL_GAUGE_ERROR_NONE;
+        }
+    }
+
+    FinishRequest(device, request, error);
+
+    return (error == FUEL_GAUGE_ERROR_NONE);
+}
+
+// Pops the head of the async queue and notifies its owner
+static inline void CompleteQueuedRequest(FuelGaugeDevice *device,
+                                         FuelGaugeError error)
+{
+    FuelGaugeRequest *request = device->queueHead;
+
+    device->queueHead = request->next;
+
+    if (device->queueHead == NULL)
+        device->queueTail = NULL;
+
+    request->next = NULL;
+    FinishRequest(device, request, error);
+
+    if (request->callback != NULL)
+        request->callback(request);
+}
+
+// Counts a failed attempt and holds the bus for the backoff if the policy allows another one
+static inline bool ScheduleRetry(FuelGaugeDevice *device,
+                                 uint8_t *attempts,
+                                 FuelGaugeError error)
+{
+    const FuelGaugeRetryPolicy *policy = &device->retryPolicy;
+
+    (*attempts)++;
+
+    if ((*attempts) >= policy->maxAttempts || (policy->retryMask & FUEL_GAUGE_RETRY_ON(error)) == 0)
+        return false;
+
+    uint32_t backoffUs = policy->backoffUs;
+
+    for (uint8_t i = 1; (i < (*attempts)) && (backoffUs < policy->maxBackoffUs); i++)
+        backoffUs *= 2;
+
+    if (backoffUs > policy->maxBackoffUs)
+        backoffUs = policy->maxBackoffUs;
+
+    HoldBus(device, backoffUs);
+
+    return true;
+}
+
+// Retries the current step of a request, the steps before it are not repeated;
+// a MAC response that fails its checksum is read again without writing the command
+static inline bool RetryStep(FuelGaugeDevice *device,
+                             FuelGaugeRequest *request,
+                             FuelGaugeError error)
+{
+    if (ScheduleRetry(device, &request->attempts, error) == false)
+        return false;
+
+    CountRetry(device, request);
+
+    return true;
+}
+
+// Keeps the outcome of an operation and frees the bus after too many failures in a row
+static inline void RecordResult(FuelGaugeDevice *device,
+                                FuelGaugeError error)
+{
+    const FuelGaugeRetryPolicy *policy = &device->retryPolicy;
+
+    device->lastError = error;
+
+    if (error == FUEL_GAUGE_ERROR_NONE) {
+        device->consecutiveFailures = 0;
+        return;
+    }
+
+    if (device->consecutiveFailures < UINT8_MAX)
+        device->consecutiveFailures++;
+
+    if (policy->recoveryThreshold != 0
+        && device->consecutiveFailures >= policy->recoveryThreshold
+        && policy->recoverBus != NULL) {
+        device->consecutiveFailures = 0;
+        policy->recoverBus();
+    }
+}
+
+// The Count* hooks compile to nothing unless FUEL_GAUGE_ENABLE_STATS is defined
+static inline void CountRequestStart(FuelGaugeDevice *device,
+                                     FuelGaugeRequest *request)
+{
+#ifdef FUEL_GAUGE_ENABLE_STATS
+    __atomic_fetch_add(&device->stats.requests[request->type].calls, 1, __ATOMIC_RELAXED);
+
+    if (device->clock != NULL)
+        request->startUs = device->clock->getTimeUs();
+#else
+    (void) device;
+    (void) request;
+#endif
+}
+
+static inline void CountRequestEnd(FuelGaugeDevice *device,
+                                   FuelGaugeRequest *request,
+                                   bool result)
+{
+#ifdef FUEL_GAUGE_ENABLE_STATS
+    FuelGaugeRequestStats *stats = &device->stats.requests[request->type];
+
+    if (result == false)
+        __atomic_fetch_add(&stats->failures, 1, __ATOMIC_RELAXED);
+
+    if (device->clock != NULL) {
+        uint32_t elapsedUs = device->clock->getTimeUs() - request->startUs;
+        uint8_t bucket = 0;
+
+        // bucket n holds 2^(n-1) <= elapsedUs < 2^n
+        while (elapsedUs != 0 && bucket < FUEL_GAUGE_STATS_BUCKETS - 1) {
+            elapsedUs >>= 1;
+            bucket++;
+        }
+
+        __atomic_fetch_add(&stats->latency[bucket], 1, __ATOMIC_RELAXED);
+    }
+#else
+    (void) device;
+    (void) request;
+    (void) result;
+#endif
+}
+
+static inline void CountOpenFailure(FuelGaugeDevice *device)
+{
+#ifdef FUEL_GAUGE_ENABLE_STATS
+    __atomic_fetch_add(&device->stats.openFailures, 1, __ATOMIC_RELAXED);
+#else
+    (void) device;
+#endif
+}
+
+static inline void CountRetry(FuelGaugeDevice *device,
+                              FuelGaugeRequest *request)
+{
+#ifdef FUEL_GAUGE_ENABLE_STATS
+    __atomic_fetch_add(&device->stats.requests[request->type].retries, 1, __ATOMIC_RELAXED);
+#else
+    (void) device;
+    (void) request;
+#endif
+}
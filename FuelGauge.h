@@ -11,6 +11,41 @@
 #include <stdint.h>
 
 
+#define FUEL_GAUGE_I2C_ADDRESS              0x55 // 0xAA is the 8-bit address
+#define FUEL_GAUGE_ROM_I2C_ADDRESS          0x0B // 0x16 is the 8-bit address
+#define FUEL_GAUGE_TWI_SPEED                TWI_100KHZ
+
+#define FUEL_GAUGE_STANDARD_REG_COUNT       0x40 // 0x00 to 0x3F in one burst
+#define FUEL_GAUGE_CACHE_MAC_ENTRIES        4
+#define FUEL_GAUGE_CACHE_MAC_DATA_SIZE      12
+#define FUEL_GAUGE_CACHE_MAC_CMD_SIZE       2
+#define FUEL_GAUGE_MAC_RESPONSE_SIZE        36   // 0x3E to 0x61: command, 32 data bytes, MacDataSum, MacDataLen
+#define FUEL_GAUGE_DF_START                 0x4000
+#define FUEL_GAUGE_DF_SIZE                  0x2000 // data flash is 0x4000 to 0x5FFF
+#define FUEL_GAUGE_DF_BLOCK_SIZE            32
+#ifndef FUEL_GAUGE_DF_CACHE_BLOCKS
+#define FUEL_GAUGE_DF_CACHE_BLOCKS          2    // data flash blocks kept by FuelGaugeDataFlashRead/Write
+#endif
+#define FUEL_GAUGE_DF_WRITE_US              2000 // data flash programming time after a block write
+#ifndef FUEL_GAUGE_DF_BATCH_BLOCKS
+#define FUEL_GAUGE_DF_BATCH_BLOCKS          4    // distinct data flash blocks one batch can edit
+#endif
+
+#ifndef FUEL_GAUGE_IMAGE_MAX_DATA
+#define FUEL_GAUGE_IMAGE_MAX_DATA           64   // longest W:/C: payload accepted from a flash stream
+#endif
+#define FUEL_GAUGE_IMAGE_CHUNK_SIZE         32
+
+#ifndef FUEL_GAUGE_RETRY_ATTEMPTS
+#define FUEL_GAUGE_RETRY_ATTEMPTS           3    // default attempts per transfer, first one included
+#endif
+#ifndef FUEL_GAUGE_RETRY_BACKOFF_US
+#define FUEL_GAUGE_RETRY_BACKOFF_US         1000 // default wait before the first retry
+#endif
+#ifndef FUEL_GAUGE_RETRY_MAX_BACKOFF_US
+#define FUEL_GAUGE_RETRY_MAX_BACKOFF_US     8000
+#endif
+
 typedef enum {
     ERROR_NONE,
     ERROR_COLON,
@@ -18,8 +53,391 @@ typedef enum {
     ERROR_COUNT,
     ERROR_MEMCMP,
     ERROR_DEFAULT,
+    ERROR_LENGTH,
+    ERROR_READ,
+    ERROR_WRITE,
 } FuelGaugeConfigError;
 
+typedef enum {
+    FUEL_GAUGE_ERROR_NONE,
+    FUEL_GAUGE_ERROR_OPEN,              // bus could not be opened
+    FUEL_GAUGE_ERROR_TRANSFER,          // transfer NACKed or aborted by the bus
+    FUEL_GAUGE_ERROR_CHECKSUM,          // MAC response does not match its MacDataSum/MacDataLen
+} FuelGaugeError;
+
+#define FUEL_GAUGE_RETRY_ON(error)          (1UL << (error))
+
+/**
+* \brief Retry and bus recovery policy of a device.
+*
+* A failed bus open or transfer is attempted again, up to maxAttempts times
+* in total, when its error class is in retryMask (FUEL_GAUGE_RETRY_ON bits).
+* The first retry waits backoffUs, each further one twice as long up to
+* maxBackoffUs, so a failing call costs a bounded time. Backoff needs a
+* FuelGaugeClock; without one retries follow at once.
+*
+* After recoveryThreshold consecutive failed operations, recoverBus (if set)
+* is called to free the bus, e.g. clock out a gauge holding SDA low.
+* 0 disables recovery.
+*/
+typedef struct {
+    uint8_t maxAttempts;
+    uint32_t backoffUs;
+    uint32_t maxBackoffUs;
+    uint32_t retryMask;
+    uint8_t recoveryThreshold;
+    void (*recoverBus)(void);
+} FuelGaugeRetryPolicy;
+
+/**
+* \brief Source of a flash stream (df.fs text) for FuelGaugeExecuteGoldenImageStream().
+*
+* read copies up to size bytes into buffer and returns how many it copied,
+* 0 at the end of the stream or a negative value on error. rewind restarts
+* the stream from its first byte; only incremental runs need it.
+*/
+typedef struct {
+    int32_t (*read)(void *context, uint8_t *buffer, uint32_t size);
+    bool (*rewind)(void *context);
+    void *context;
+} FuelGaugeImageReader;
+
+typedef struct {
+    uint16_t blocksWritten;
+    uint16_t blocksSkipped;
+} FuelGaugeImageStats;
+
+// context of FuelGaugeImageMemoryRead
+typedef struct {
+    const char *text;
+    uint32_t size;
+    uint32_t position;
+} FuelGaugeImageMemory;
+
+typedef enum {
+    FUEL_GAUGE_CACHE_STANDARD,      // standard registers (voltage, current, SoC, ...)
+    FUEL_GAUGE_CACHE_MAC,           // MAC primed reads (status words, chem ID, ...)
+    FUEL_GAUGE_CACHE_CLASS_COUNT,
+} FuelGaugeCacheClass;
+
+/**
+* \brief Result cache configuration.
+*
+* getTimeMs is a free-running millisecond clock; a cached value is served
+* while it is younger than the TTL of its register class (0 disables
+* caching for that class).
+*/
+typedef struct {
+    uint32_t (*getTimeMs)(void);
+    uint32_t ttlMs[FUEL_GAUGE_CACHE_CLASS_COUNT];
+} FuelGaugeCacheConfig;
+
+typedef struct {
+    uint32_t hits[FUEL_GAUGE_CACHE_CLASS_COUNT];
+    uint32_t misses[FUEL_GAUGE_CACHE_CLASS_COUNT];
+} FuelGaugeCacheStats;
+
+typedef struct {
+    bool valid;
+    uint32_t timestamp;
+    uint16_t value;
+} FuelGaugeStandardCacheEntry;
+
+typedef struct {
+    bool valid;
+    uint32_t timestamp;
+    uint8_t registerAddress;
+    uint8_t cmd[FUEL_GAUGE_CACHE_MAC_CMD_SIZE];
+    uint8_t sizeOfCmd;
+    uint8_t data[FUEL_GAUGE_CACHE_MAC_DATA_SIZE];
+    uint8_t sizeOfData;
+} FuelGaugeMacCacheEntry;
+
+typedef struct {
+    bool valid;
+    uint16_t address;                   // FUEL_GAUGE_DF_BLOCK_SIZE aligned
+    uint8_t data[FUEL_GAUGE_DF_BLOCK_SIZE];
+} FuelGaugeDataFlashCacheEntry;
+
+typedef struct {
+    uint16_t address;                   // FUEL_GAUGE_DF_BLOCK_SIZE aligned
+    uint32_t edited;                    // one bit per byte of data
+    uint8_t data[FUEL_GAUGE_DF_BLOCK_SIZE];
+} FuelGaugeDataFlashBatchBlock;
+
+/**
+* \brief Data flash edits collected by FuelGaugeDataFlashBatchSet() and
+* written by FuelGaugeDataFlashBatchCommit(), grouped per 32-byte block.
+*/
+typedef struct {
+    FuelGaugeDataFlashBatchBlock blocks[FUEL_GAUGE_DF_BATCH_BLOCKS];
+    uint8_t count;
+} FuelGaugeDataFlashBatch;
+
+typedef enum {
+    FUEL_GAUGE_REQUEST_READ,            // read from a register
+    FUEL_GAUGE_REQUEST_PRIMED_READ,     // write a MAC command, then read its response
+    FUEL_GAUGE_REQUEST_WRITE,           // write to a register
+    FUEL_GAUGE_REQUEST_TYPE_COUNT,
+} FuelGaugeRequestType;
+
+typedef enum {
+    FUEL_GAUGE_REQUEST_IDLE,
+    FUEL_GAUGE_REQUEST_QUEUED,
+    FUEL_GAUGE_REQUEST_BUSY,
+    FUEL_GAUGE_REQUEST_DONE,
+    FUEL_GAUGE_REQUEST_FAILED,
+} FuelGaugeRequestState;
+
+typedef struct FuelGaugeRequest FuelGaugeRequest;
+
+typedef void (*FuelGaugeRequestCallback)(FuelGaugeRequest *request);
+
+/**
+* \brief Descriptor of one bus operation on a gauge.
+*
+* Set up with one of the FuelGaugeRequestInit* functions. An address of 0
+* targets the device's own address. state doubles as a future: it reads
+* FUEL_GAUGE_REQUEST_DONE or FUEL_GAUGE_REQUEST_FAILED once the request
+* finished, right before callback (if any) is invoked, and error tells why
+* a request failed. A request waiting for a retry is queued again.
+*
+* A primed read at ManufacturerAccess (0x3E) reads the response from 0x3E
+* through MacDataSum and MacDataLen in one transaction after the command,
+* and checks it against MacDataSum before its first sizeOfData bytes
+* (command echo first) are handed over. A mismatch reads the response
+* again, the command is not resent.
+*/
+struct FuelGaugeRequest {
+    FuelGaugeRequestType type;
+    uint8_t address;
+    uint8_t registerAddress;
+    const uint8_t *cmd;                 // MAC command or write payload
+    uint8_t sizeOfCmd;
+    uint8_t *data;                      // read destination
+    uint8_t sizeOfData;
+    FuelGaugeRequestCallback callback;
+    void *context;
+    volatile FuelGaugeRequestState state;
+    FuelGaugeError error;
+
+    // engine state
+    uint8_t step;
+    uint8_t attempts;
+    FuelGaugeRequest *next;
+#ifdef FUEL_GAUGE_ENABLE_STATS
+    uint32_t startUs;
+#endif
+};
+
+#ifdef FUEL_GAUGE_ENABLE_STATS
+#ifndef FUEL_GAUGE_STATS_BUCKETS
+#define FUEL_GAUGE_STATS_BUCKETS            20   // log2 latency buckets, up to 2^18 us and slower
+#endif
+
+/**
+* \brief Counters of one request type, kept in FUEL_GAUGE_ENABLE_STATS builds.
+*
+* latency[n] counts requests that took at least 2^(n-1) and less than 2^n us
+* (latency[0]: under 1 us), the last bucket everything slower. Latency runs
+* from the start (sync) or submission (async) of a request to its end and is
+* only measured on devices with a FuelGaugeClock.
+*/
+typedef struct {
+    uint32_t calls;
+    uint32_t failures;
+    uint32_t retries;
+    uint32_t latency[FUEL_GAUGE_STATS_BUCKETS];
+} FuelGaugeRequestStats;
+
+/**
+* \brief Request counters of a device, kept in FUEL_GAUGE_ENABLE_STATS builds.
+*
+* The counters are updated with 32-bit atomics, so FUEL_GAUGE_ENABLE_STATS
+* requires a target where those are lock-free; ARMv6-M (Cortex-M0/M0+) is not.
+*/
+typedef struct {
+    FuelGaugeRequestStats requests[FUEL_GAUGE_REQUEST_TYPE_COUNT];
+    uint32_t openFailures;              // bus could not be opened, no transfer attempted
+} FuelGaugeStats;
+#endif
+
+/**
+* \brief Non-blocking extension of the I2C/TWI interface.
+*
+* Each function starts a transfer and returns at once; the platform reports
+* the end of the transfer (typically from the DMA/TWI interrupt) with
+* FuelGaugeDevTransferComplete().
+*/
+typedef struct {
+    bool (*startRead)(uint8_t address, const uint8_t *reg, uint8_t regSize, void *data, uint8_t size);
+    bool (*startWrite)(uint8_t address, const uint8_t *reg, uint8_t regSize, const uint8_t *data, uint8_t size);
+} FuelGaugeTwiAsync;
+
+/**
+* \brief Time source used to space I2C transactions.
+*
+* getTimeUs is a free-running microsecond counter (wrap-around is fine);
+* delayUs busy-waits or sleeps for at least the given time.
+*/
+typedef struct {
+    uint32_t (*getTimeUs)(void);
+    void (*delayUs)(uint32_t us);
+} FuelGaugeClock;
+
+/**
+* \brief One BQ27Z561 on an I2C/TWI bus.
+*
+* Set up with FuelGaugeDeviceInit(); address, romAddress and speed may be
+* changed afterwards (e.g. for a gauge behind a mux). The remaining fields
+* are driver state.
+*/
+typedef struct {
+    TwiInterface *twi;
+    uint8_t address;
+    uint8_t romAddress;
+    TwiSpeed speed;
+
+    uint8_t sessionDepth;
+    bool romMode;                       // a golden image put the gauge in ROM mode, until it exits
+
+    const FuelGaugeClock *clock;
+    bool busHeld;
+    uint32_t busFreeUs;
+
+    bool cacheEnabled;
+    FuelGaugeCacheConfig cacheConfig;
+    FuelGaugeCacheStats cacheStats;
+    FuelGaugeStandardCacheEntry standardCache[FUEL_GAUGE_STANDARD_REG_COUNT / sizeof(uint16_t)];
+    FuelGaugeMacCacheEntry macCache[FUEL_GAUGE_CACHE_MAC_ENTRIES];
+    uint8_t macCacheNext;
+    FuelGaugeDataFlashCacheEntry dataFlashCache[FUEL_GAUGE_DF_CACHE_BLOCKS];
+    uint8_t dataFlashCacheNext;
+    volatile bool interruptPending;
+
+    const FuelGaugeTwiAsync *twiAsync;
+    FuelGaugeRequest *queueHead;
+    FuelGaugeRequest *queueTail;
+    bool asyncBusOpen;
+    volatile bool transferPending;
+    volatile bool transferResult;
+    uint8_t macResponse[FUEL_GAUGE_MAC_RESPONSE_SIZE];
+
+    FuelGaugeRetryPolicy retryPolicy;
+    FuelGaugeError lastError;
+    uint8_t consecutiveFailures;
+
+#ifdef FUEL_GAUGE_ENABLE_STATS
+    FuelGaugeStats stats;
+#endif
+} FuelGaugeDevice;
+
+/**
+* \brief Decoded copy of the standard command range (0x00 to 0x3F).
+*/
+typedef struct {
+    uint16_t controlStatus;
+    int16_t atRate;                 // mA
+    uint16_t atRateTimeToEmpty;     // min
+    uint16_t temperature;           // 0.1 K
+    uint16_t voltage;               // mV
+    uint16_t batteryStatus;
+    int16_t current;                // mA
+    uint16_t remainingCapacity;     // mAh
+    uint16_t fullChargeCapacity;    // mAh
+    int16_t averageCurrent;         // mA
+    uint16_t averageTimeToEmpty;    // min
+    uint16_t averageTimeToFull;     // min
+    int16_t maxLoadCurrent;         // mA
+    uint16_t maxLoadTimeToEmpty;    // min
+    int16_t averagePower;           // mW
+    uint16_t internalTemperature;   // 0.1 K
+    uint16_t cycleCount;
+    uint16_t relativeSoc;           // %
+    uint16_t soh;                   // %
+    uint16_t chargingVoltage;       // mV
+    uint16_t chargingCurrent;       // mA
+    uint16_t designCapacity;        // mAh
+} FuelGaugeSnapshot;
+
+/**
+* \brief MAC subcommands read by FuelGaugeReadMac(), one entry each:
+* X(name, subcommand, response data bytes, decoder). The decoder sets the
+* type of the value filled in:
+*
+*   U16       uint16_t, little endian
+*   STATUS24  uint32_t, byte 0 on top of the little endian word in bytes 1-2
+*   STATUS32  uint32_t, the little endian words in bytes 0-1 and 2-3 swapped
+*   WORDS     uint16_t[bytes / 2], little endian
+*   BYTES     uint8_t[bytes], as sent
+*
+* The two status layouts are those FuelGaugeGetChargingStatus() and
+* FuelGaugeGetOperationStatus() have always returned.
+*/
+#define FUEL_GAUGE_MAC_COMMANDS(X)                                      \
+    X(FIRMWARE_VERSION,         0x0002,     11,     BYTES)              \
+    X(CHEM_ID,                  0x0006,     2,      U16)                \
+    X(OPERATION_STATUS,         0x0054,     4,      STATUS32)           \
+    X(CHARGING_STATUS,          0x0055,     3,      STATUS24)           \
+    X(GAUGING_STATUS,           0x0056,     4,      STATUS32)           \
+    X(MANUFACTURING_STATUS,     0x0057,     2,      U16)                \
+    X(LIFETIME_DATA,            0x0060,     32,     BYTES)              \
+    X(DA_STATUS1,               0x0071,     32,     WORDS)              \
+    X(DA_STATUS2,               0x0072,     16,     WORDS)              \
+    X(IT_STATUS1,               0x0073,     24,     WORDS)              \
+    X(IT_STATUS2,               0x0074,     24,     WORDS)              \
+    X(IT_STATUS3,               0x0075,     16,     WORDS)
+
+typedef enum {
+#define FUEL_GAUGE_MAC_ENUM(name, command, size, decoder)   FUEL_GAUGE_MAC_##name,
+    FUEL_GAUGE_MAC_COMMANDS(FUEL_GAUGE_MAC_ENUM)
+#undef FUEL_GAUGE_MAC_ENUM
+    FUEL_GAUGE_MAC_COUNT
+} FuelGaugeMac;
+
+/**
+* \brief Voltage and temperature thresholds of the gauge (0x62 to 0x6D).
+*
+* A flag in InterruptStatus is set, and GPOUT asserted when configured as
+* interrupt output, once a value crosses its set threshold; it can fire
+* again only after the value went back past the clear threshold.
+*/
+typedef struct {
+    uint16_t voltageHighSet;            // mV
+    uint16_t voltageHighClear;
+    uint16_t voltageLowSet;
+    uint16_t voltageLowClear;
+    int8_t temperatureHighSet;          // degrees C
+    int8_t temperatureHighClear;
+    int8_t temperatureLowSet;
+    int8_t temperatureLowClear;
+} FuelGaugeThresholds;
+
+// InterruptStatus flags
+#define FUEL_GAUGE_INT_VOLT_HI              (1 << 0)
+#define FUEL_GAUGE_INT_VOLT_LO              (1 << 1)
+#define FUEL_GAUGE_INT_TEMP_HI              (1 << 2)
+#define FUEL_GAUGE_INT_TEMP_LO              (1 << 3)
+
+/**
+* \brief Pack health data read by FuelGaugeReadDiagnostics(), without padding
+* so it can be stored or sent as is. Values are decoded as FuelGaugeReadMac()
+* decodes the subcommand of the same name.
+*/
+typedef struct __attribute__((packed)) {
+    uint32_t operationStatus;
+    uint32_t gaugingStatus;
+    uint32_t chargingStatus;
+    uint16_t manufacturingStatus;
+    uint16_t daStatus1[16];
+    uint16_t daStatus2[8];
+    uint16_t itStatus1[12];
+    uint16_t itStatus2[12];
+    uint16_t itStatus3[8];
+    uint8_t lifetimeData[32];
+    uint32_t busTimeUs;                 // whole sweep, 0 without a FuelGaugeClock
+} FuelGaugeDiagnostics;
+
 
 /**
 * \brief Setup an I2C/TWI interface.
@@ -28,6 +446,179 @@ typedef enum {
 */
 void FuelGaugeInitTwi(TwiInterface *twi);
 
+/**
+* \brief Attach a clock to the default device to enforce I2C timing.
+*
+* Without a clock, transactions run back to back and X: delays of flash
+* streams are skipped. With one, each transaction is started no earlier than
+* 66 us after the previous one, or after the end of an X: delay. Only the
+* remaining part of that time is waited for.
+*
+* \param FuelGaugeClock *clock Time source, NULL to detach.
+*/
+void FuelGaugeInitClock(const FuelGaugeClock *clock);
+
+/**
+* \brief Setup a device handle with the default addresses and bus speed.
+*
+* \param FuelGaugeDevice *device Handle to initialize.
+* \param TwiInterface *twi Pointer to the I2C/TWI interface of the gauge's bus.
+*/
+void FuelGaugeDeviceInit(FuelGaugeDevice *device, TwiInterface *twi);
+
+/**
+* \brief Attach a clock to a device, see FuelGaugeInitClock().
+*/
+void FuelGaugeDeviceInitClock(FuelGaugeDevice *device, const FuelGaugeClock *clock);
+
+/**
+* \brief Attach a non-blocking I2C/TWI extension to a device, enabling
+* FuelGaugeDevSubmitRequest().
+*
+* \param FuelGaugeDevice *device Handle of the gauge.
+* \param FuelGaugeTwiAsync *twiAsync Non-blocking transfer functions of its bus.
+*/
+void FuelGaugeDeviceInitAsync(FuelGaugeDevice *device, const FuelGaugeTwiAsync *twiAsync);
+
+/**
+* \brief Setup a request that reads size bytes starting at a register.
+*/
+void FuelGaugeRequestInitRead(FuelGaugeRequest *request,
+                              uint8_t registerAddress,
+                              uint8_t *data,
+                              uint8_t size);
+
+/**
+* \brief Setup a request that writes a MAC command and reads the response.
+*/
+void FuelGaugeRequestInitPrimedRead(FuelGaugeRequest *request,
+                                    uint8_t registerAddress,
+                                    const uint8_t *cmd,
+                                    uint8_t sizeOfCmd,
+                                    uint8_t *data,
+                                    uint8_t size);
+
+/**
+* \brief Setup a request that writes size bytes starting at a register.
+*/
+void FuelGaugeRequestInitWrite(FuelGaugeRequest *request,
+                               uint8_t registerAddress,
+                               const uint8_t *data,
+                               uint8_t size);
+
+/**
+* \brief Queues a request on a device with a non-blocking extension.
+*
+* The request and its buffers must stay valid until it completed. Requests
+* run in submission order and bypass the result cache; completed writes
+* invalidate it.
+*
+* Blocking calls and requests are exclusive per device: do not make blocking
+* FuelGaugeDev* calls while requests are queued. A session opened before may
+* stay open, the request engine keeps the bus open until its queue drains.
+*
+* \return true if queued, false if the request is already queued.
+*/
+bool FuelGaugeDevSubmitRequest(FuelGaugeDevice *device, FuelGaugeRequest *request);
+
+/**
+* \brief Reports the end of the transfer started through FuelGaugeTwiAsync.
+* Safe to call from interrupt context: it only sets flags, the bus free time
+* is applied by FuelGaugeDevProcessRequests().
+*
+* \param result true if the transfer succeeded.
+*/
+void FuelGaugeDevTransferComplete(FuelGaugeDevice *device, bool result);
+
+/**
+* \brief Advances the request engine of a device: starts queued requests,
+* finishes completed transfers and invokes callbacks. Call it from the task
+* that submits requests, e.g. once per control loop iteration.
+*
+* \return true while requests are pending.
+*/
+bool FuelGaugeDevProcessRequests(FuelGaugeDevice *device);
+
+/**
+* \brief Gets the device handle used by the functions without a handle.
+*
+* \return the default device.
+*/
+FuelGaugeDevice *FuelGaugeGetDefaultDevice(void);
+
+/**
+* \brief Opens the I2C/TWI bus for a batch of fuel gauge operations.
+*
+* Every FuelGauge* call made before the matching FuelGaugeEndSession()
+* reuses the open bus instead of opening and closing it per transfer.
+* Sessions may be nested.
+*
+* \return true if successful, false otherwise.
+*/
+bool FuelGaugeBeginSession(void);
+
+/**
+* \brief Closes the I2C/TWI bus opened by FuelGaugeBeginSession().
+*/
+void FuelGaugeEndSession(void);
+
+/**
+* \brief Sets the retry and bus recovery policy. The default retries open,
+* transfer and checksum errors FUEL_GAUGE_RETRY_ATTEMPTS times with
+* exponential backoff and does not recover the bus.
+*
+* \param policy copied by the driver.
+*/
+void FuelGaugeSetRetryPolicy(const FuelGaugeRetryPolicy *policy);
+
+/**
+* \brief Gets the error of the latest bus operation, after its retries.
+*
+* \return FUEL_GAUGE_ERROR_NONE if it succeeded.
+*/
+FuelGaugeError FuelGaugeGetLastError(void);
+
+/**
+* \brief Enables the register result cache. Disabled by default.
+*
+* \param config TTLs and time source, copied by the driver.
+*/
+void FuelGaugeCacheEnable(const FuelGaugeCacheConfig *config);
+
+/**
+* \brief Disables and clears the register result cache.
+*/
+void FuelGaugeCacheDisable(void);
+
+/**
+* \brief Drops every cached value. Writes to the gauge do this automatically.
+*/
+void FuelGaugeCacheInvalidate(void);
+
+/**
+* \brief Gets cache hit/miss counters per register class.
+*
+* \param stats counters since the cache was last enabled.
+*/
+void FuelGaugeCacheGetStats(FuelGaugeCacheStats *stats);
+
+#ifdef FUEL_GAUGE_ENABLE_STATS
+/**
+* \brief Gets the request counters and latency histograms.
+*
+* Counters are updated without locks, so this may run concurrently with
+* requests; each counter is read atomically, the set as a whole is not.
+*
+* \param stats counters since the device was set up or last reset.
+*/
+void FuelGaugeGetStats(FuelGaugeStats *stats);
+
+/**
+* \brief Clears the request counters and latency histograms.
+*/
+void FuelGaugeResetStats(void);
+#endif
+
 /**
 * \brief Gets control status from the BQ27Z561.
 *
@@ -119,6 +710,16 @@ bool FuelGaugeGetSoh(uint16_t *capacity);
 */
 bool FuelGaugeGetCapacity(uint16_t *capacity);
 
+/**
+* \brief Reads all standard registers from the BQ27Z561 in one
+* auto-incrementing I2C read.
+*
+* \param snapshot decoded register values.
+*
+* \return true if successful, false otherwise.
+*/
+bool FuelGaugeReadSnapshot(FuelGaugeSnapshot *snapshot);
+
 /**
 * \brief Gets operation status for the BQ27Z561.
 *
@@ -164,6 +765,136 @@ bool FuelGaugeGetChargingStatus(uint32_t *chargingStatus);
 */
 bool FuelGaugeGetChemId(uint16_t *chemId);
 
+/**
+* \brief Reads a MAC subcommand and decodes its response.
+*
+* \param mac subcommand from FUEL_GAUGE_MAC_COMMANDS.
+* \param value of the type its decoder fills in.
+*
+* \return true if successful, false otherwise.
+*/
+bool FuelGaugeReadMac(FuelGaugeMac mac, void *value);
+
+/**
+* \brief Reads several MAC subcommands back to back in one bus session.
+*
+* \param macs subcommands to read, in order.
+* \param values one value per subcommand, see FuelGaugeReadMac().
+* \param count of subcommands.
+*
+* \return true if every read succeeded, false otherwise (the remaining
+* subcommands are still read).
+*/
+bool FuelGaugeReadMacs(const FuelGaugeMac *macs, void *const *values, uint8_t count);
+
+/**
+* \brief Reads the status words and the DA, IT and Lifetime status blocks
+* back to back in one bus session.
+*
+* \param diagnostics filled in, busTimeUs included.
+*
+* \return true if every read succeeded, false otherwise.
+*/
+bool FuelGaugeReadDiagnostics(FuelGaugeDiagnostics *diagnostics);
+
+/**
+* \brief Reads data flash through ManufacturerBlockAccess (gauge must be
+* unsealed).
+*
+* Recently read 32-byte blocks are kept, so neighbouring parameters do not
+* fetch the same block again. Any write through the driver drops them, and
+* FuelGaugeCacheInvalidate() does too; call it before reading values the
+* gauge updates on its own, e.g. learned capacity or lifetime data.
+*
+* \param address of the first byte, e.g. 0x4643 for Power Config.
+* \param data filled in, in data flash (little endian) order.
+* \param size in bytes.
+*
+* \return true if successful, false otherwise, without any transfer if the
+* range is not within FUEL_GAUGE_DF_START and FUEL_GAUGE_DF_SIZE.
+*/
+bool FuelGaugeDataFlashRead(uint16_t address, uint8_t *data, uint16_t size);
+
+/**
+* \brief Writes data flash through ManufacturerBlockAccess (gauge must be
+* unsealed), one transfer per 32-byte block touched. Only the given bytes
+* are written, so no read is needed beforehand; kept blocks are updated.
+*
+* \param address of the first byte.
+* \param data in data flash (little endian) order.
+* \param size in bytes.
+*
+* \return true if successful, false otherwise, without any transfer if the
+* range is not within FUEL_GAUGE_DF_START and FUEL_GAUGE_DF_SIZE.
+*/
+bool FuelGaugeDataFlashWrite(uint16_t address, const uint8_t *data, uint16_t size);
+
+/**
+* \brief Programs the voltage and temperature thresholds in one transfer.
+*
+* \param thresholds to program.
+*
+* \return true if successful, false otherwise.
+*/
+bool FuelGaugeSetThresholds(const FuelGaugeThresholds *thresholds);
+
+/**
+* \brief Reads the voltage and temperature thresholds in one transfer.
+*
+* \param thresholds filled in.
+*
+* \return true if successful, false otherwise.
+*/
+bool FuelGaugeGetThresholds(FuelGaugeThresholds *thresholds);
+
+/**
+* \brief Notes that the gauge raised its interrupt (GPOUT) pin. Touches no
+* bus, so it may be called from the pin's interrupt handler.
+*/
+void FuelGaugeInterruptNotify(void);
+
+/**
+* \brief Reads InterruptStatus if FuelGaugeInterruptNotify() was called since
+* the last successful service; otherwise the bus is not used at all. Call it
+* from task context instead of polling voltage and temperature.
+*
+* \param status FUEL_GAUGE_INT_* flags, 0 if nothing was pending.
+*
+* \return true if successful, false otherwise (the interrupt stays pending).
+*/
+bool FuelGaugeInterruptService(uint8_t *status);
+
+/**
+* \brief Empties a data flash batch.
+*/
+void FuelGaugeDataFlashBatchInit(FuelGaugeDataFlashBatch *batch);
+
+/**
+* \brief Adds a data flash edit to a batch, nothing is written yet. A later
+* edit of the same bytes replaces the earlier one.
+*
+* \param address of the first byte.
+* \param data in data flash (little endian) order, copied.
+* \param size in bytes.
+*
+* \return false if the edit would touch more than FUEL_GAUGE_DF_BATCH_BLOCKS
+* blocks or is not within FUEL_GAUGE_DF_START and FUEL_GAUGE_DF_SIZE, the
+* batch is then unchanged.
+*/
+bool FuelGaugeDataFlashBatchSet(FuelGaugeDataFlashBatch *batch, uint16_t address, const uint8_t *data, uint16_t size);
+
+/**
+* \brief Writes a batch in one bus session (gauge must be unsealed). Each
+* touched block is written once, from its first to its last edited byte;
+* unedited bytes in between are read first and written back unchanged.
+* Every block is then read back once to verify it.
+*
+* \param batch emptied on success.
+*
+* \return ERROR_NONE, ERROR_READ, ERROR_WRITE or ERROR_MEMCMP.
+*/
+FuelGaugeConfigError FuelGaugeDataFlashBatchCommit(FuelGaugeDataFlashBatch *batch);
+
 /**
 * \brief Enable the Impedance Tracking algorithm on the BQ27Z561.
 *
@@ -230,6 +961,9 @@ bool FuelGaugeResetLifetimeHistory(void);
 /**
 * \brief Send return-to-firmware command if BQ27Z561 is in ROM mode.
 *
+* Sent at 400 kHz when called alone; inside a session it goes out at the
+* speed the session opened the bus with.
+*
 * \return true if successful, false otherwise.
 */
 bool FuelGaugeExitRomMode(void);
@@ -241,4 +975,119 @@ bool FuelGaugeExitRomMode(void);
 */
 FuelGaugeConfigError FuelGaugeExecuteGoldenImage(void);
 
+/**
+* \brief Execute a flash stream of any size onto BQ27Z561, pulling it through
+* a reader (file, external flash, ...) and parsing it line by line with a
+* fixed amount of memory.
+*
+* \param reader source of the df.fs text.
+*
+* \return FuelGaugeConfigError.
+*/
+FuelGaugeConfigError FuelGaugeExecuteGoldenImageStream(const FuelGaugeImageReader *reader);
+
+/**
+* \brief Execute a flash stream onto BQ27Z561, leaving out its ROM mode
+* session when the gauge already holds every data flash row of the image.
+*
+* A first pass reads the data flash rows targeted by the image back through
+* MAC block access, so the gauge must be unsealed with full access before the
+* call. ROM mode erases all of data flash before writing the rows, so either
+* every row matches and the image is run again from the start without ROM
+* mode entry, erase, rows, checksum and exit, or the whole image is run.
+* Rows that cannot be read back do not match.
+*
+* \param reader source of the df.fs text, rewind is required.
+* \param stats data flash rows written and skipped, may be NULL.
+*
+* \return FuelGaugeConfigError.
+*/
+FuelGaugeConfigError FuelGaugeExecuteGoldenImageIncremental(const FuelGaugeImageReader *reader,
+                                                            FuelGaugeImageStats *stats);
+
+/**
+* \brief FuelGaugeImageReader read function for a flash stream held in memory.
+*
+* \param context FuelGaugeImageMemory describing the text.
+*/
+int32_t FuelGaugeImageMemoryRead(void *context, uint8_t *buffer, uint32_t size);
+
+/**
+* \brief FuelGaugeImageReader rewind function for a flash stream held in memory.
+*/
+bool FuelGaugeImageMemoryRewind(void *context);
+
+/**
+* \brief Execute a flash stream compiled by tools/GoldenImageCompiler
+* (see GoldenImageFormat.h) onto BQ27Z561, without any text parsing.
+*
+* \param image record stream, e.g. goldenImageBinary from GoldenImageBinary.h.
+* \param size of the stream in bytes.
+*
+* \return FuelGaugeConfigError.
+*/
+FuelGaugeConfigError FuelGaugeExecuteGoldenImageBinary(const uint8_t *image, uint32_t size);
+
+/*
+ * Device handle variants. Each behaves like the function of the same name
+ * without the Dev infix, on the given device instead of the default one.
+ */
+bool FuelGaugeDevBeginSession(FuelGaugeDevice *device);
+void FuelGaugeDevEndSession(FuelGaugeDevice *device);
+void FuelGaugeDevSetRetryPolicy(FuelGaugeDevice *device, const FuelGaugeRetryPolicy *policy);
+FuelGaugeError FuelGaugeDevGetLastError(FuelGaugeDevice *device);
+void FuelGaugeDevCacheEnable(FuelGaugeDevice *device, const FuelGaugeCacheConfig *config);
+void FuelGaugeDevCacheDisable(FuelGaugeDevice *device);
+void FuelGaugeDevCacheInvalidate(FuelGaugeDevice *device);
+void FuelGaugeDevCacheGetStats(FuelGaugeDevice *device, FuelGaugeCacheStats *stats);
+#ifdef FUEL_GAUGE_ENABLE_STATS
+void FuelGaugeDevGetStats(FuelGaugeDevice *device, FuelGaugeStats *stats);
+void FuelGaugeDevResetStats(FuelGaugeDevice *device);
+#endif
+bool FuelGaugeDevGetControlStatus(FuelGaugeDevice *device, uint16_t *controlStatus);
+bool FuelGaugeDevGetVoltage(FuelGaugeDevice *device, uint16_t *voltage);
+bool FuelGaugeDevGetBatteryStatus(FuelGaugeDevice *device, uint16_t *status);
+bool FuelGaugeDevReadSnapshot(FuelGaugeDevice *device, FuelGaugeSnapshot *snapshot);
+bool FuelGaugeDevGetManufacturingStatus(FuelGaugeDevice *device, uint16_t *status);
+bool FuelGaugeDevGetOperationStatus(FuelGaugeDevice *device, uint32_t *opStatus);
+bool FuelGaugeDevGetGaugingStatus(FuelGaugeDevice *device, uint32_t *gaugingStatus);
+bool FuelGaugeDevGetChargingStatus(FuelGaugeDevice *device, uint32_t *chargingStatus);
+bool FuelGaugeDevGetChemId(FuelGaugeDevice *device, uint16_t *chemId);
+bool FuelGaugeDevGetUpdateStatus(FuelGaugeDevice *device, uint8_t *updateStatus);
+bool FuelGaugeDevReadMac(FuelGaugeDevice *device, FuelGaugeMac mac, void *value);
+bool FuelGaugeDevReadMacs(FuelGaugeDevice *device, const FuelGaugeMac *macs, void *const *values, uint8_t count);
+bool FuelGaugeDevReadDiagnostics(FuelGaugeDevice *device, FuelGaugeDiagnostics *diagnostics);
+bool FuelGaugeDevDataFlashRead(FuelGaugeDevice *device, uint16_t address, uint8_t *data, uint16_t size);
+bool FuelGaugeDevDataFlashWrite(FuelGaugeDevice *device, uint16_t address, const uint8_t *data, uint16_t size);
+bool FuelGaugeDevSetThresholds(FuelGaugeDevice *device, const FuelGaugeThresholds *thresholds);
+bool FuelGaugeDevGetThresholds(FuelGaugeDevice *device, FuelGaugeThresholds *thresholds);
+void FuelGaugeDevInterruptNotify(FuelGaugeDevice *device);
+bool FuelGaugeDevInterruptService(FuelGaugeDevice *device, uint8_t *status);
+FuelGaugeConfigError FuelGaugeDevDataFlashBatchCommit(FuelGaugeDevice *device, FuelGaugeDataFlashBatch *batch);
+bool FuelGaugeDevGetCurrent(FuelGaugeDevice *device, int16_t *current);
+bool FuelGaugeDevGetRemainingCapacity(FuelGaugeDevice *device, uint16_t *capacity);
+bool FuelGaugeDevGetFullChargeCapacity(FuelGaugeDevice *device, uint16_t *capacity);
+bool FuelGaugeDevGetRelativeSoc(FuelGaugeDevice *device, uint16_t *soc);
+bool FuelGaugeDevGetSoh(FuelGaugeDevice *device, uint16_t *soh);
+bool FuelGaugeDevGetCapacity(FuelGaugeDevice *device, uint16_t *capacity);
+bool FuelGaugeDevEnableImpedanceTracking(FuelGaugeDevice *device);
+bool FuelGaugeDevDisableImpedanceTracking(FuelGaugeDevice *device);
+bool FuelGaugeDevEnableLifetimeTracking(FuelGaugeDevice *device);
+bool FuelGaugeDevDisableLifetimeTracking(FuelGaugeDevice *device);
+bool FuelGaugeDevReset(FuelGaugeDevice *device);
+bool FuelGaugeDevUnseal(FuelGaugeDevice *device);
+bool FuelGaugeDevFullAccess(FuelGaugeDevice *device);
+bool FuelGaugeDevSeal(FuelGaugeDevice *device);
+bool FuelGaugeDevResetLifetimeHistory(FuelGaugeDevice *device);
+bool FuelGaugeDevExitRomMode(FuelGaugeDevice *device);
+FuelGaugeConfigError FuelGaugeDevExecuteGoldenImage(FuelGaugeDevice *device);
+FuelGaugeConfigError FuelGaugeDevExecuteGoldenImageStream(FuelGaugeDevice *device,
+                                                          const FuelGaugeImageReader *reader);
+FuelGaugeConfigError FuelGaugeDevExecuteGoldenImageIncremental(FuelGaugeDevice *device,
+                                                               const FuelGaugeImageReader *reader,
+                                                               FuelGaugeImageStats *stats);
+FuelGaugeConfigError FuelGaugeDevExecuteGoldenImageBinary(FuelGaugeDevice *device,
+                                                          const uint8_t *image,
+                                                          uint32_t size);
+
 #endif  // SYSTEM_MONITOR_FUEL_GAUGE_H_
@@ -0,0 +1,249 @@
+// Twi interface and macros/defines defined by you.
+#include "CommonDefinesAndMacros.h"
+
+/*
+ * Note:    Every field of the arbiter is only touched with the platform lock
+ *          held. The bus is opened and closed under the lock as well, so a
+ *          new holder never sees a session that is half closed.
+*/
+
+#include "FuelGaugeArbiter.h"
+
+
+/**
+ *  Local function prototypes
+ */
+static inline bool IsBefore(const FuelGaugeArbiterWaiter *a,
+                            const FuelGaugeArbiterWaiter *b);
+static inline void PushWaiter(FuelGaugeArbiter *arbiter,
+                              FuelGaugeArbiterWaiter *waiter);
+static inline FuelGaugeArbiterWaiter *PopWaiter(FuelGaugeArbiter *arbiter);
+static inline void SwapWaiters(FuelGaugeArbiter *arbiter,
+                               uint8_t a,
+                               uint8_t b);
+
+
+/**
+* \brief Setup an arbiter for a device.
+*/
+void FuelGaugeArbiterInit(FuelGaugeArbiter *arbiter,
+                          FuelGaugeDevice *device,
+                          const FuelGaugeArbiterLock *lock)
+{
+    configASSERT(arbiter != NULL);
+    configASSERT(device != NULL);
+    configASSERT(lock != NULL && lock->lock != NULL && lock->unlock != NULL
+                 && lock->wait != NULL && lock->broadcast != NULL);
+
+    memset(arbiter, 0, sizeof(*arbiter));
+
+    arbiter->device = device;
+    arbiter->lock = lock;
+}
+
+/**
+* \brief Waits until the calling thread holds the device, with the bus open.
+*/
+bool FuelGaugeArbiterAcquire(FuelGaugeArbiter *arbiter, uint8_t priority)
+{
+    const FuelGaugeArbiterLock *lock = arbiter->lock;
+
+    lock->lock(lock->context);
+
+    if (arbiter->owned == false && arbiter->waiterCount == 0) {
+        arbiter->owned = true;
+        arbiter->ownerPriority = priority;
+        arbiter->grants++;
+    } else {
+        FuelGaugeArbiterWaiter waiter = {
+            .priority = priority,
+            .order = arbiter->order++,
+            .granted = false,
+        };
+
+        if (arbiter->waiterCount == FUEL_GAUGE_ARBITER_WAITERS) {
+            lock->unlock(lock->context);
+            return false;
+        }
+
+        PushWaiter(arbiter, &waiter);
+
+        while (waiter.granted == false)
+            lock->wait(lock->context);
+    }
+
+    if (arbiter->sessionOpen == false)
+        arbiter->sessionOpen = FuelGaugeDevBeginSession(arbiter->device);
+
+    bool result = arbiter->sessionOpen;
+
+    lock->unlock(lock->context);
+
+    if (result == false)
+        FuelGaugeArbiterRelease(arbiter);
+
+    return result;
+}
+
+/**
+* \brief Hands the device to the next waiter, or closes the bus if none.
+*/
+void FuelGaugeArbiterRelease(FuelGaugeArbiter *arbiter)
+{
+    const FuelGaugeArbiterLock *lock = arbiter->lock;
+
+    lock->lock(lock->context);
+
+    configASSERT(arbiter->owned == true);
+
+    if (arbiter->waiterCount > 0) {
+        FuelGaugeArbiterWaiter *waiter = PopWaiter(arbiter);
+
+        // the bus stays open for the next holder
+        arbiter->ownerPriority = waiter->priority;
+        arbiter->grants++;
+        arbiter->handoffs += (arbiter->sessionOpen == true);
+        waiter->granted = true;
+
+        lock->broadcast(lock->context);
+    } else {
+        arbiter->owned = false;
+
+        if (arbiter->sessionOpen == true) {
+            FuelGaugeDevEndSession(arbiter->device);
+            arbiter->sessionOpen = false;
+        }
+    }
+
+    lock->unlock(lock->context);
+}
+
+/**
+* \brief Lets the critical waiters run first, then holds the device again.
+*/
+void FuelGaugeArbiterYield(FuelGaugeArbiter *arbiter)
+{
+    const FuelGaugeArbiterLock *lock = arbiter->lock;
+
+    lock->lock(lock->context);
+
+    uint8_t priority = arbiter->ownerPriority;
+    bool preempted = (arbiter->waiterCount > 0
+                      && arbiter->waiters[0]->priority == FUEL_GAUGE_PRIORITY_CRITICAL
+                      && priority < FUEL_GAUGE_PRIORITY_CRITICAL);
+
+    // a full queue keeps the bulk holder going
+    if (preempted == true && arbiter->waiterCount < FUEL_GAUGE_ARBITER_WAITERS) {
+        // queued behind the critical waiters before handing over, so nothing
+        // else lands in the middle of the bulk operation
+        FuelGaugeArbiterWaiter waiter = {
+            .priority = FUEL_GAUGE_PRIORITY_CRITICAL,
+            .order = arbiter->order++,
+            .granted = false,
+        };
+        PushWaiter(arbiter, &waiter);
+
+        FuelGaugeArbiterWaiter *next = PopWaiter(arbiter);
+
+        arbiter->ownerPriority = next->priority;
+        arbiter->grants++;
+        arbiter->handoffs++;
+        next->granted = true;
+
+        lock->broadcast(lock->context);
+
+        while (waiter.granted == false)
+            lock->wait(lock->context);
+
+        arbiter->ownerPriority = priority;
+    }
+
+    lock->unlock(lock->context);
+}
+
+/**
+* \brief FuelGaugeImageReader read function that yields before every read
+* made outside ROM mode.
+*/
+int32_t FuelGaugeArbiterImageRead(void *context, uint8_t *buffer, uint32_t size)
+{
+    FuelGaugeArbiterImageReader *reader = (FuelGaugeArbiterImageReader *) context;
+
+    // in ROM mode the gauge NACKs its firmware address, a critical read would only fail
+    if (reader->arbiter->device->romMode == false)
+        FuelGaugeArbiterYield(reader->arbiter);
+
+    return reader->reader->read(reader->reader->context, buffer, size);
+}
+
+/**
+* \brief FuelGaugeImageReader rewind function of FuelGaugeArbiterImageReader.
+*/
+bool FuelGaugeArbiterImageRewind(void *context)
+{
+    FuelGaugeArbiterImageReader *reader = (FuelGaugeArbiterImageReader *) context;
+
+    return (reader->reader->rewind != NULL && reader->reader->rewind(reader->reader->context));
+}
+
+/***********************************************************************
+   Static functions.
+***********************************************************************/
+static inline bool IsBefore(const FuelGaugeArbiterWaiter *a,
+                            const FuelGaugeArbiterWaiter *b)
+{
+    if (a->priority != b->priority)
+        return (a->priority > b->priority);
+
+    return ((int32_t) (a->order - b->order) < 0);
+}
+
+static inline void PushWaiter(FuelGaugeArbiter *arbiter,
+                              FuelGaugeArbiterWaiter *waiter)
+{
+    uint8_t index = arbiter->waiterCount++;
+
+    arbiter->waiters[index] = waiter;
+
+    while (index > 0 && IsBefore(arbiter->waiters[index], arbiter->waiters[(index - 1) / 2]) == true) {
+        SwapWaiters(arbiter, index, (index - 1) / 2);
+        index = (index - 1) / 2;
+    }
+}
+
+static inline FuelGaugeArbiterWaiter *PopWaiter(FuelGaugeArbiter *arbiter)
+{
+    FuelGaugeArbiterWaiter *first = arbiter->waiters[0];
+    uint8_t index = 0;
+
+    arbiter->waiters[0] = arbiter->waiters[--arbiter->waiterCount];
+
+    for (;;) {
+        uint8_t child = 2 * index + 1;
+
+        if (child >= arbiter->waiterCount)
+            break;
+
+        if (child + 1 < arbiter->waiterCount
+            && IsBefore(arbiter->waiters[child + 1], arbiter->waiters[child]) == true)
+            child++;
+
+        if (IsBefore(arbiter->waiters[child], arbiter->waiters[index]) == false)
+            break;
+
+        SwapWaiters(arbiter, index, child);
+        index = child;
+    }
+
+    return first;
+}
+
+static inline void SwapWaiters(FuelGaugeArbiter *arbiter,
+                               uint8_t a,
+                               uint8_t b)
+{
+    FuelGaugeArbiterWaiter *waiter = arbiter->waiters[a];
+
+    arbiter->waiters[a] = arbiter->waiters[b];
+    arbiter->waiters[b] = waiter;
+}
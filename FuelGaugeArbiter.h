@@ -0,0 +1,112 @@
+#ifndef SYSTEM_MONITOR_FUEL_GAUGE_ARBITER_H_
+#define SYSTEM_MONITOR_FUEL_GAUGE_ARBITER_H_
+
+/*
+ * Note:    The driver itself does no locking: two threads calling into the
+ *          same device interleave e.g. the MAC command write of one with the
+ *          response read of the other. The arbiter serializes them. A thread
+ *          wraps its FuelGaugeDev* calls in FuelGaugeArbiterAcquire() and
+ *          FuelGaugeArbiterRelease(); waiting threads are granted the device by
+ *          priority, then in arrival order.
+ *
+ *          The bus session is handed from one holder to the next without
+ *          closing the bus, so queued operations run back to back under one
+ *          bus open; it closes once nobody waits anymore.
+*/
+#include "FuelGauge.h"
+
+#include <stdint.h>
+
+
+#ifndef FUEL_GAUGE_ARBITER_WAITERS
+#define FUEL_GAUGE_ARBITER_WAITERS          8    // threads that can wait for the device at once
+#endif
+
+#define FUEL_GAUGE_PRIORITY_BULK            0    // golden image, data flash, diagnostics
+#define FUEL_GAUGE_PRIORITY_NORMAL          1
+// Standard commands only (voltage, current, ...): FuelGaugeArbiterYield() may
+// grant these in between the steps of a bulk operation.
+#define FUEL_GAUGE_PRIORITY_CRITICAL        2
+
+
+/**
+* \brief Platform locking, e.g. a pthread mutex and condition variable.
+*
+* wait is entered with the lock held, releases it while sleeping and holds
+* it again on return, like pthread_cond_wait(); it may return spuriously.
+* broadcast wakes every waiter.
+*/
+typedef struct {
+    void (*lock)(void *context);
+    void (*unlock)(void *context);
+    void (*wait)(void *context);
+    void (*broadcast)(void *context);
+    void *context;
+} FuelGaugeArbiterLock;
+
+typedef struct {
+    uint8_t priority;
+    uint32_t order;
+    volatile bool granted;
+} FuelGaugeArbiterWaiter;
+
+typedef struct {
+    FuelGaugeDevice *device;
+    const FuelGaugeArbiterLock *lock;
+
+    bool owned;
+    uint8_t ownerPriority;
+    bool sessionOpen;
+    uint32_t order;
+    FuelGaugeArbiterWaiter *waiters[FUEL_GAUGE_ARBITER_WAITERS];  // binary heap, highest priority first
+    uint8_t waiterCount;
+
+    uint32_t grants;
+    uint32_t handoffs;                  // grants made without closing the bus in between
+} FuelGaugeArbiter;
+
+
+/**
+* \brief Setup an arbiter for a device, the device must not be used otherwise.
+*/
+void FuelGaugeArbiterInit(FuelGaugeArbiter *arbiter,
+                          FuelGaugeDevice *device,
+                          const FuelGaugeArbiterLock *lock);
+
+/**
+* \brief Waits until the calling thread holds the device, with the bus open.
+*
+* \param priority one of FUEL_GAUGE_PRIORITY_*, higher is served first.
+*
+* \return false if FUEL_GAUGE_ARBITER_WAITERS threads already wait or the bus
+* could not be opened; the device is not held then.
+*/
+bool FuelGaugeArbiterAcquire(FuelGaugeArbiter *arbiter, uint8_t priority);
+
+/**
+* \brief Hands the device to the next waiter, or closes the bus if none.
+*/
+void FuelGaugeArbiterRelease(FuelGaugeArbiter *arbiter);
+
+/**
+* \brief Called by a bulk holder in between steps: lets the critical waiters
+* run first, then holds the device again ahead of every other waiter. The
+* bus stays open throughout.
+*/
+void FuelGaugeArbiterYield(FuelGaugeArbiter *arbiter);
+
+/**
+* \brief FuelGaugeImageReader that yields to critical waiters before every
+* read, for FuelGaugeDevExecuteGoldenImageStream() under an arbiter. While
+* the image holds the gauge in ROM mode it does not yield, critical waiters
+* are served once the gauge runs firmware again.
+*/
+typedef struct {
+    FuelGaugeArbiter *arbiter;
+    const FuelGaugeImageReader *reader; // the actual source
+} FuelGaugeArbiterImageReader;
+
+int32_t FuelGaugeArbiterImageRead(void *context, uint8_t *buffer, uint32_t size);
+bool FuelGaugeArbiterImageRewind(void *context);
+
+#endif  // SYSTEM_MONITOR_FUEL_GAUGE_ARBITER_H_
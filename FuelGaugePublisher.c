@@ -0,0 +1,121 @@
+// Twi interface and macros/defines defined by you.
+#include "CommonDefinesAndMacros.h"
+
+/*
+ * Note:    The publication is copied word by word with relaxed atomics so a
+ *          reader racing the producer reads torn but defined values, which
+ *          the sequence check then discards.
+*/
+
+#include "FuelGaugePublisher.h"
+
+
+/**
+ *  Local function prototypes
+ */
+static inline uint32_t GetSchedulerTimeMs(const FuelGaugeScheduler *scheduler);
+
+
+/**
+* \brief Setup an empty publisher.
+*/
+void FuelGaugePublisherInit(FuelGaugePublisher *publisher)
+{
+    configASSERT(publisher != NULL);
+
+    atomic_init(&publisher->sequence, 0);
+
+    for (uint8_t index = 0; index < FUEL_GAUGE_PUBLICATION_WORDS; index++)
+        atomic_init(&publisher->words[index], 0);
+}
+
+/**
+* \brief Publishes new values. Producer thread only, never blocks.
+*/
+void FuelGaugePublisherPublish(FuelGaugePublisher *publisher,
+                               const FuelGaugePublication *publication)
+{
+    uint32_t words[FUEL_GAUGE_PUBLICATION_WORDS] = {0};
+    uint32_t sequence = atomic_load_explicit(&publisher->sequence, memory_order_relaxed);
+    FuelGaugePublication copy = (*publication);
+
+    // the copy counts publications, the atomic sequence counts half writes
+    copy.sequence = sequence / 2 + 1;
+    memcpy(words, &copy, sizeof(copy));
+
+    atomic_store_explicit(&publisher->sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    for (uint8_t index = 0; index < FUEL_GAUGE_PUBLICATION_WORDS; index++)
+        atomic_store_explicit(&publisher->words[index], words[index], memory_order_relaxed);
+
+    atomic_store_explicit(&publisher->sequence, sequence + 2, memory_order_release);
+}
+
+/**
+* \brief Copies the latest publication. Any thread, never blocks.
+*/
+bool FuelGaugePublisherRead(FuelGaugePublisher *publisher,
+                            FuelGaugePublication *publication)
+{
+    uint32_t words[FUEL_GAUGE_PUBLICATION_WORDS];
+
+    for (uint8_t attempt = 0; attempt < FUEL_GAUGE_PUBLISHER_READ_ATTEMPTS; attempt++) {
+        uint32_t sequence = atomic_load_explicit(&publisher->sequence, memory_order_acquire);
+
+        if (sequence == 0)
+            return false;
+
+        // the producer is mid publication
+        if (sequence & 1)
+            continue;
+
+        for (uint8_t index = 0; index < FUEL_GAUGE_PUBLICATION_WORDS; index++)
+            words[index] = atomic_load_explicit(&publisher->words[index], memory_order_relaxed);
+
+        atomic_thread_fence(memory_order_acquire);
+
+        if (atomic_load_explicit(&publisher->sequence, memory_order_relaxed) == sequence) {
+            memcpy(publication, words, sizeof(*publication));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+* \brief FuelGaugePollCallback that publishes the scheduler's latest values.
+*/
+void FuelGaugePublisherPollCallback(void *context,
+                                    const FuelGaugeScheduler *scheduler,
+                                    FuelGaugePollGroup group,
+                                    bool result)
+{
+    // diagnostics are not part of the publication
+    if (result == false || group == FUEL_GAUGE_POLL_DIAGNOSTICS)
+        return;
+
+    FuelGaugePublication publication = {
+        .timeMs = GetSchedulerTimeMs(scheduler),
+        .snapshot = scheduler->snapshot,
+        .operationStatus = scheduler->operationStatus,
+        .gaugingStatus = scheduler->gaugingStatus,
+        .chargingStatus = scheduler->chargingStatus,
+        .manufacturingStatus = scheduler->manufacturingStatus,
+    };
+
+    FuelGaugePublisherPublish((FuelGaugePublisher *) context, &publication);
+}
+
+/***********************************************************************
+   Static functions.
+***********************************************************************/
+// The poll that just finished is the latest of the two published groups
+static inline uint32_t GetSchedulerTimeMs(const FuelGaugeScheduler *scheduler)
+{
+    uint32_t snapshotMs = scheduler->lastPollMs[FUEL_GAUGE_POLL_SNAPSHOT];
+    uint32_t statusMs = scheduler->lastPollMs[FUEL_GAUGE_POLL_STATUS];
+
+    return ((int32_t) (snapshotMs - statusMs) > 0) ? snapshotMs : statusMs;
+}
@@ -0,0 +1,77 @@
+#ifndef SYSTEM_MONITOR_FUEL_GAUGE_PUBLISHER_H_
+#define SYSTEM_MONITOR_FUEL_GAUGE_PUBLISHER_H_
+
+/*
+ * Note:    Producer mode for multi threaded hosts. One poller thread owns the
+ *          bus, it is the only one calling FuelGauge* functions, and publishes
+ *          what it read. Any number of reader threads take the latest coherent
+ *          publication without bus access and without locks.
+ *
+ *          This is a seqlock over C11 atomics: the sequence is odd while a
+ *          publication is written, and a reader retries when it changed under
+ *          its copy. The producer never waits for readers.
+*/
+#include "FuelGauge.h"
+#include "FuelGaugeScheduler.h"
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+
+#ifndef FUEL_GAUGE_PUBLISHER_READ_ATTEMPTS
+#define FUEL_GAUGE_PUBLISHER_READ_ATTEMPTS  64   // copies a reader tries before giving up
+#endif
+
+
+typedef struct {
+    uint32_t sequence;                  // publication count, increases by one per publication
+    uint32_t timeMs;                    // when the producer read the values
+    FuelGaugeSnapshot snapshot;
+    uint32_t operationStatus;
+    uint32_t gaugingStatus;
+    uint32_t chargingStatus;
+    uint16_t manufacturingStatus;
+} FuelGaugePublication;
+
+#define FUEL_GAUGE_PUBLICATION_WORDS        ((sizeof(FuelGaugePublication) + 3) / 4)
+
+typedef struct {
+    atomic_uint_fast32_t sequence;      // odd while the producer writes
+    atomic_uint_least32_t words[FUEL_GAUGE_PUBLICATION_WORDS];
+} FuelGaugePublisher;
+
+
+/**
+* \brief Setup an empty publisher.
+*/
+void FuelGaugePublisherInit(FuelGaugePublisher *publisher);
+
+/**
+* \brief Publishes new values. Producer thread only, never blocks.
+*
+* publication->sequence is ignored and set by the publisher.
+*/
+void FuelGaugePublisherPublish(FuelGaugePublisher *publisher,
+                               const FuelGaugePublication *publication);
+
+/**
+* \brief Copies the latest publication. Any thread, never blocks.
+*
+* \return false if nothing was published yet, or if the producer kept
+* publishing during FUEL_GAUGE_PUBLISHER_READ_ATTEMPTS copies.
+*/
+bool FuelGaugePublisherRead(FuelGaugePublisher *publisher,
+                            FuelGaugePublication *publication);
+
+/**
+* \brief FuelGaugePollCallback that publishes the scheduler's latest values
+* after every successful snapshot or status poll.
+*
+* \param context the FuelGaugePublisher.
+*/
+void FuelGaugePublisherPollCallback(void *context,
+                                    const FuelGaugeScheduler *scheduler,
+                                    FuelGaugePollGroup group,
+                                    bool result);
+
+#endif  // SYSTEM_MONITOR_FUEL_GAUGE_PUBLISHER_H_
@@ -0,0 +1,323 @@
+// Twi interface and macros/defines defined by you.
+#include "CommonDefinesAndMacros.h"
+
+/*
+ * Note:    Groups are polled only through the public FuelGauge API, so the
+ *          scheduler works with any device, cache or retry configuration.
+*/
+
+#include "FuelGaugeScheduler.h"
+
+
+/**
+ *  Defines
+ */
+#define MS_PER_HOUR                         3600000UL
+#define EARLY_POLL_DIVIDER                  8       // a group up to 1/8 of its interval early joins a session
+
+
+/**
+ *  Local function prototypes
+ */
+static inline bool IsGroupEnabled(const FuelGaugeScheduler *scheduler,
+                                  FuelGaugePollGroup group);
+static inline bool IsGroupDue(const FuelGaugeScheduler *scheduler,
+                              FuelGaugePollGroup group,
+                              uint32_t now,
+                              uint32_t earlyMs);
+static inline bool PollGroup(FuelGaugeScheduler *scheduler,
+                             FuelGaugePollGroup group,
+                             uint32_t now);
+static inline bool PollSnapshot(FuelGaugeScheduler *scheduler,
+                                uint32_t now);
+static inline bool PollStatus(FuelGaugeScheduler *scheduler);
+static inline uint16_t GetLoadActivity(const FuelGaugeScheduler *scheduler);
+static inline uint16_t GetSocActivity(FuelGaugeScheduler *scheduler,
+                                      uint32_t now);
+static inline uint16_t GetSlopeActivity(const FuelGaugeScheduler *scheduler,
+                                        uint32_t delta,
+                                        uint32_t elapsedMs);
+static inline void UpdateIntervals(FuelGaugeScheduler *scheduler,
+                                   uint16_t activity);
+
+
+/**
+* \brief Setup a scheduler for a device.
+*/
+void FuelGaugeSchedulerInit(FuelGaugeScheduler *scheduler,
+                            FuelGaugeDevice *device,
+                            const FuelGaugeSchedulerConfig *config)
+{
+    configASSERT(scheduler != NULL);
+    configASSERT(device != NULL);
+    configASSERT(config != NULL && config->getTimeMs != NULL);
+
+    memset(scheduler, 0, sizeof(*scheduler));
+
+    scheduler->device = device;
+    scheduler->config = (*config);
+
+    for (uint8_t group = 0; group < FUEL_GAUGE_POLL_GROUP_COUNT; group++) {
+        configASSERT(config->bounds[group].minIntervalMs <= config->bounds[group].maxIntervalMs);
+
+        scheduler->intervalMs[group] = config->bounds[group].maxIntervalMs;
+    }
+}
+
+/**
+* \brief Polls every group that is due, all in one bus session.
+*/
+uint32_t FuelGaugeSchedulerRun(FuelGaugeScheduler *scheduler)
+{
+    uint32_t now = scheduler->config.getTimeMs();
+    bool sessionOpen = false;
+    uint32_t sleepMs = UINT32_MAX;
+
+    bool anyDue = false;
+
+    for (uint8_t group = 0; group < FUEL_GAUGE_POLL_GROUP_COUNT; group++)
+        anyDue |= IsGroupDue(scheduler, group, now, 0);
+
+    // groups that are almost due ride along so they stay in step with the others
+    for (uint8_t group = 0; group < FUEL_GAUGE_POLL_GROUP_COUNT && anyDue == true; group++) {
+        if (IsGroupDue(scheduler, group, now, scheduler->intervalMs[group] / EARLY_POLL_DIVIDER) == false)
+            continue;
+
+        // a failed open still lets every group try on its own
+        if (sessionOpen == false)
+            sessionOpen = FuelGaugeDevBeginSession(scheduler->device);
+
+        bool result = PollGroup(scheduler, group, now);
+
+        if (scheduler->config.callback != NULL)
+            scheduler->config.callback(scheduler->config.context, scheduler, group, result);
+    }
+
+    if (sessionOpen == true)
+        FuelGaugeDevEndSession(scheduler->device);
+
+    for (uint8_t group = 0; group < FUEL_GAUGE_POLL_GROUP_COUNT; group++) {
+        if (IsGroupEnabled(scheduler, group) == false)
+            continue;
+
+        uint32_t elapsedMs = now - scheduler->lastPollMs[group];
+        uint32_t waitMs = (elapsedMs < scheduler->intervalMs[group]) ? scheduler->intervalMs[group] - elapsedMs : 0;
+
+        if (waitMs < sleepMs)
+            sleepMs = waitMs;
+    }
+
+    return sleepMs;
+}
+
+/**
+* \brief Makes every enabled group due at the next run.
+*/
+void FuelGaugeSchedulerPollNow(FuelGaugeScheduler *scheduler)
+{
+    memset(scheduler->polled, 0, sizeof(scheduler->polled));
+}
+
+/***********************************************************************
+   Static functions.
+***********************************************************************/
+static inline bool IsGroupEnabled(const FuelGaugeScheduler *scheduler,
+                                  FuelGaugePollGroup group)
+{
+    return (scheduler->config.bounds[group].minIntervalMs != 0);
+}
+
+static inline bool IsGroupDue(const FuelGaugeScheduler *scheduler,
+                              FuelGaugePollGroup group,
+                              uint32_t now,
+                              uint32_t earlyMs)
+{
+    if (IsGroupEnabled(scheduler, group) == false)
+        return false;
+
+    return (scheduler->polled[group] == false
+            || now - scheduler->lastPollMs[group] + earlyMs >= scheduler->intervalMs[group]);
+}
+
+// Polls one group; snapshot and status results adjust every group's interval
+static inline bool PollGroup(FuelGaugeScheduler *scheduler,
+                             FuelGaugePollGroup group,
+                             uint32_t now)
+{
+    bool result;
+
+    scheduler->polled[group] = true;
+    scheduler->lastPollMs[group] = now;
+
+    switch (group) {
+        case FUEL_GAUGE_POLL_SNAPSHOT:
+            result = PollSnapshot(scheduler, now);
+            break;
+
+        case FUEL_GAUGE_POLL_STATUS:
+            result = PollStatus(scheduler);
+            break;
+
+        default:
+            result = FuelGaugeDevReadDiagnostics(scheduler->device, &scheduler->diagnostics);
+            break;
+    }
+
+    // back off towards the maximum interval while the gauge does not answer
+    if (result == false) {
+        const FuelGaugePollBounds *bounds = &scheduler->config.bounds[group];
+        uint32_t interval = scheduler->intervalMs[group];
+
+        scheduler->intervalMs[group] = (interval < bounds->maxIntervalMs / 2) ? interval * 2 : bounds->maxIntervalMs;
+    }
+
+    scheduler->valid[group] |= result;
+
+    return result;
+}
+
+static inline bool PollSnapshot(FuelGaugeScheduler *scheduler,
+                                uint32_t now)
+{
+    FuelGaugeSnapshot snapshot;
+
+    if (FuelGaugeDevReadSnapshot(scheduler->device, &snapshot) == false)
+        return false;
+
+    bool statusChanged = (scheduler->valid[FUEL_GAUGE_POLL_SNAPSHOT] == true
+                          && snapshot.batteryStatus != scheduler->snapshot.batteryStatus);
+
+    if (scheduler->valid[FUEL_GAUGE_POLL_SNAPSHOT] == false) {
+        scheduler->socTimeMs = now;
+        scheduler->socAtTime = snapshot.relativeSoc;
+    }
+
+    scheduler->snapshot = snapshot;
+
+    uint16_t activity = GetLoadActivity(scheduler);
+    uint16_t socActivity = GetSocActivity(scheduler, now);
+
+    if (socActivity > activity)
+        activity = socActivity;
+
+    UpdateIntervals(scheduler, (statusChanged == true) ? FUEL_GAUGE_ACTIVITY_MAX : activity);
+
+    return true;
+}
+
+static inline bool PollStatus(FuelGaugeScheduler *scheduler)
+{
+    uint32_t operationStatus;
+    uint32_t gaugingStatus;
+    uint32_t chargingStatus;
+    uint16_t manufacturingStatus;
+
+    static const FuelGaugeMac macs[] = {
+        FUEL_GAUGE_MAC_OPERATION_STATUS,
+        FUEL_GAUGE_MAC_GAUGING_STATUS,
+        FUEL_GAUGE_MAC_CHARGING_STATUS,
+        FUEL_GAUGE_MAC_MANUFACTURING_STATUS,
+    };
+    void *const values[] = {
+        &operationStatus,
+        &gaugingStatus,
+        &chargingStatus,
+        &manufacturingStatus,
+    };
+
+    // a failed read leaves junk in the values, keep the last good status
+    if (FuelGaugeDevReadMacs(scheduler->device, macs, values, ARRAY_COUNT(macs)) == false)
+        return false;
+
+    // a status change is the strongest hint that more is about to happen
+    if (scheduler->valid[FUEL_GAUGE_POLL_STATUS] == true
+        && (operationStatus != scheduler->operationStatus
+            || gaugingStatus != scheduler->gaugingStatus
+            || chargingStatus != scheduler->chargingStatus
+            || manufacturingStatus != scheduler->manufacturingStatus))
+        UpdateIntervals(scheduler, FUEL_GAUGE_ACTIVITY_MAX);
+
+    scheduler->operationStatus = operationStatus;
+    scheduler->gaugingStatus = gaugingStatus;
+    scheduler->chargingStatus = chargingStatus;
+    scheduler->manufacturingStatus = manufacturingStatus;
+
+    return true;
+}
+
+static inline uint16_t GetLoadActivity(const FuelGaugeScheduler *scheduler)
+{
+    int32_t current = scheduler->snapshot.current;
+    uint32_t magnitude = (current < 0) ? -current : current;
+
+    if (scheduler->config.fullLoadCurrentMa == 0 || magnitude >= scheduler->config.fullLoadCurrentMa)
+        return FUEL_GAUGE_ACTIVITY_MAX;
+
+    return (magnitude * FUEL_GAUGE_ACTIVITY_MAX) / scheduler->config.fullLoadCurrentMa;
+}
+
+// SoC moves in whole percents, so its slope is measured from one change to the
+// next; in between, the last slope holds until 1% over the time since the
+// change would be slower
+static inline uint16_t GetSocActivity(FuelGaugeScheduler *scheduler,
+                                      uint32_t now)
+{
+    uint16_t soc = scheduler->snapshot.relativeSoc;
+    uint32_t elapsedMs = now - scheduler->socTimeMs;
+
+    if (soc == scheduler->socAtTime) {
+        uint16_t bound = GetSlopeActivity(scheduler, 1, elapsedMs);
+
+        return (bound < scheduler->socActivity) ? bound : scheduler->socActivity;
+    }
+
+    uint32_t delta = (soc > scheduler->socAtTime) ? soc - scheduler->socAtTime : scheduler->socAtTime - soc;
+
+    scheduler->socTimeMs = now;
+    scheduler->socAtTime = soc;
+    scheduler->socActivity = GetSlopeActivity(scheduler, delta, elapsedMs);
+
+    return scheduler->socActivity;
+}
+
+static inline uint16_t GetSlopeActivity(const FuelGaugeScheduler *scheduler,
+                                        uint32_t delta,
+                                        uint32_t elapsedMs)
+{
+    if (scheduler->config.fullSocSlopePerHour == 0 || elapsedMs == 0)
+        return FUEL_GAUGE_ACTIVITY_MAX;
+
+    // compared as delta / elapsed >= full / hour, without overflowing
+    uint64_t scaled = (uint64_t) delta * MS_PER_HOUR * FUEL_GAUGE_ACTIVITY_MAX;
+    uint64_t full = (uint64_t) scheduler->config.fullSocSlopePerHour * elapsedMs;
+    uint64_t activity = scaled / full;
+
+    return (activity > FUEL_GAUGE_ACTIVITY_MAX) ? FUEL_GAUGE_ACTIVITY_MAX : (uint16_t) activity;
+}
+
+// Shrinks intervals at once when activity rises, grows them at most twofold per update
+static inline void UpdateIntervals(FuelGaugeScheduler *scheduler,
+                                   uint16_t activity)
+{
+    scheduler->activity = activity;
+
+    for (uint8_t group = 0; group < FUEL_GAUGE_POLL_GROUP_COUNT; group++) {
+        const FuelGaugePollBounds *bounds = &scheduler->config.bounds[group];
+        uint32_t range = bounds->maxIntervalMs - bounds->minIntervalMs;
+        uint32_t target = bounds->maxIntervalMs
+                          - (uint32_t) (((uint64_t) range * activity) / FUEL_GAUGE_ACTIVITY_MAX);
+        uint32_t interval = scheduler->intervalMs[group];
+
+        if (target < interval)
+            interval = target;
+        else if (interval < target / 2)
+            interval *= 2;
+        else
+            interval = target;
+
+        if (interval < bounds->minIntervalMs)
+            interval = bounds->minIntervalMs;
+
+        scheduler->intervalMs[group] = interval;
+    }
+}
@@ -0,0 +1,107 @@
+#ifndef SYSTEM_MONITOR_FUEL_GAUGE_SCHEDULER_H_
+#define SYSTEM_MONITOR_FUEL_GAUGE_SCHEDULER_H_
+
+/*
+ * Note:    Adaptive polling on top of the FuelGauge getters. Each register group
+ *          is polled at an interval between its configured bounds, picked from
+ *          the latest current, the SoC slope and status word changes: a pack at
+ *          rest is polled at the maximum intervals, a loaded or changing one at
+ *          the minimum.
+*/
+#include "FuelGauge.h"
+
+#include <stdint.h>
+
+
+#define FUEL_GAUGE_ACTIVITY_MAX             1000 // activity is in permille
+
+
+typedef enum {
+    FUEL_GAUGE_POLL_SNAPSHOT,           // standard registers, FuelGaugeReadSnapshot()
+    FUEL_GAUGE_POLL_STATUS,             // Operation, Gauging, Charging and Manufacturing status
+    FUEL_GAUGE_POLL_DIAGNOSTICS,        // FuelGaugeReadDiagnostics()
+    FUEL_GAUGE_POLL_GROUP_COUNT
+} FuelGaugePollGroup;
+
+typedef struct FuelGaugeScheduler FuelGaugeScheduler;
+
+/**
+* \brief Called after each poll of a group, result tells whether it succeeded.
+*/
+typedef void (*FuelGaugePollCallback)(void *context,
+                                      const FuelGaugeScheduler *scheduler,
+                                      FuelGaugePollGroup group,
+                                      bool result);
+
+typedef struct {
+    uint32_t minIntervalMs;             // used at full activity; 0 disables the group
+    uint32_t maxIntervalMs;             // used at rest
+} FuelGaugePollBounds;
+
+/**
+* \brief Scheduler configuration.
+*
+* Activity is the largest of |current| relative to fullLoadCurrentMa and the
+* SoC slope relative to fullSocSlopePerHour, or full when a status word
+* changed since the previous poll. A group's interval shrinks at once when
+* activity rises and at most doubles per poll when it falls. A failed poll
+* doubles the interval of its group, up to the maximum.
+*/
+typedef struct {
+    uint32_t (*getTimeMs)(void);        // free-running millisecond clock
+    FuelGaugePollBounds bounds[FUEL_GAUGE_POLL_GROUP_COUNT];
+    uint16_t fullLoadCurrentMa;
+    uint16_t fullSocSlopePerHour;       // % of SoC per hour
+    FuelGaugePollCallback callback;     // optional
+    void *context;
+} FuelGaugeSchedulerConfig;
+
+struct FuelGaugeScheduler {
+    FuelGaugeDevice *device;
+    FuelGaugeSchedulerConfig config;
+
+    // latest values, valid once their group was polled successfully
+    FuelGaugeSnapshot snapshot;
+    uint32_t operationStatus;
+    uint32_t gaugingStatus;
+    uint32_t chargingStatus;
+    uint16_t manufacturingStatus;
+    FuelGaugeDiagnostics diagnostics;
+
+    // engine state
+    uint16_t activity;
+    uint32_t intervalMs[FUEL_GAUGE_POLL_GROUP_COUNT];
+    uint32_t lastPollMs[FUEL_GAUGE_POLL_GROUP_COUNT];
+    bool polled[FUEL_GAUGE_POLL_GROUP_COUNT];
+    bool valid[FUEL_GAUGE_POLL_GROUP_COUNT];
+    uint32_t socTimeMs;                 // when snapshot.relativeSoc was last seen to change or first read
+    uint16_t socAtTime;
+    uint16_t socActivity;               // SoC slope activity measured at that change
+};
+
+
+/**
+* \brief Setup a scheduler for a device. Every enabled group is due at once,
+* then starts at its maximum interval.
+*
+* \param config copied by the scheduler.
+*/
+void FuelGaugeSchedulerInit(FuelGaugeScheduler *scheduler,
+                            FuelGaugeDevice *device,
+                            const FuelGaugeSchedulerConfig *config);
+
+/**
+* \brief Polls every group that is due, all in one bus session. Groups within
+* an eighth of their interval of being due are polled along with them.
+*
+* \return milliseconds until the next group is due, to sleep in between.
+*/
+uint32_t FuelGaugeSchedulerRun(FuelGaugeScheduler *scheduler);
+
+/**
+* \brief Makes every enabled group due at the next FuelGaugeSchedulerRun(),
+* e.g. after FuelGaugeInterruptService() reported an event.
+*/
+void FuelGaugeSchedulerPollNow(FuelGaugeScheduler *scheduler);
+
+#endif  // SYSTEM_MONITOR_FUEL_GAUGE_SCHEDULER_H_
@@ -0,0 +1,258 @@
+// Twi interface and macros/defines defined by you.
+#include "CommonDefinesAndMacros.h"
+
+/*
+ * Note:    Records never span more than FUEL_GAUGE_TELEMETRY_RECORD_MAX bytes
+ *          and may wrap around the end of the ring.
+*/
+
+#include "FuelGaugeTelemetry.h"
+
+
+/**
+ *  Defines
+ */
+#define FIELD_VOLTAGE                       (1 << 0)
+#define FIELD_CURRENT                       (1 << 1)
+#define FIELD_TEMPERATURE                   (1 << 2)
+#define FIELD_RELATIVE_SOC                  (1 << 3)
+#define FIELD_SOH                           (1 << 4)
+#define FIELD_BATTERY_STATUS                (1 << 5)
+#define FIELD_OPERATION_STATUS              (1 << 6)
+
+#define VARINT_MORE                         0x80
+
+_Static_assert(FUEL_GAUGE_TELEMETRY_SIZE >= FUEL_GAUGE_TELEMETRY_RECORD_MAX, "ring smaller than a record");
+_Static_assert(FUEL_GAUGE_TELEMETRY_SIZE <= UINT16_MAX, "ring positions are 16 bit");
+
+
+/**
+ *  Local function prototypes
+ */
+static inline uint8_t EncodeRecord(const FuelGaugeTelemetrySample *previous,
+                                   const FuelGaugeTelemetrySample *sample,
+                                   uint8_t *record);
+static inline uint16_t DecodeRecord(const FuelGaugeTelemetry *telemetry,
+                                    uint16_t position,
+                                    FuelGaugeTelemetrySample *sample);
+static inline void EncodeDelta(uint8_t *record, uint8_t *size, uint8_t *mask, uint8_t field,
+                               int32_t previous, int32_t value);
+static inline void EncodeFlips(uint8_t *record, uint8_t *size, uint8_t *mask, uint8_t field,
+                               uint32_t previous, uint32_t value);
+static inline uint8_t PutVarint(uint8_t *record, uint32_t value);
+static inline uint32_t GetVarint(const FuelGaugeTelemetry *telemetry, uint16_t *position);
+static inline uint32_t ZigzagEncode(int32_t value);
+static inline int32_t ZigzagDecode(uint32_t value);
+static inline uint16_t Advance(uint16_t position, uint16_t count);
+
+
+/**
+* \brief Empties the ring.
+*/
+void FuelGaugeTelemetryInit(FuelGaugeTelemetry *telemetry)
+{
+    configASSERT(telemetry != NULL);
+
+    memset(telemetry, 0, sizeof(*telemetry));
+}
+
+/**
+* \brief Appends a sample taken from a snapshot and the Operation Status word.
+*/
+void FuelGaugeTelemetryAppend(FuelGaugeTelemetry *telemetry,
+                              uint32_t timeMs,
+                              const FuelGaugeSnapshot *snapshot,
+                              uint32_t operationStatus)
+{
+    uint8_t record[FUEL_GAUGE_TELEMETRY_RECORD_MAX];
+    FuelGaugeTelemetrySample sample = {
+        .timeMs = timeMs,
+        .voltage = snapshot->voltage,
+        .current = snapshot->current,
+        .temperature = snapshot->temperature,
+        .relativeSoc = snapshot->relativeSoc,
+        .soh = snapshot->soh,
+        .batteryStatus = snapshot->batteryStatus,
+        .operationStatus = operationStatus,
+    };
+
+    if (telemetry->count == 0) {
+        telemetry->base = sample;
+        telemetry->last = sample;
+        telemetry->count = 1;
+        return;
+    }
+
+    uint8_t size = EncodeRecord(&telemetry->last, &sample, record);
+
+    // fold the oldest records into base until the new one fits
+    while (FUEL_GAUGE_TELEMETRY_SIZE - telemetry->used < size) {
+        uint16_t tail = DecodeRecord(telemetry, telemetry->tail, &telemetry->base);
+
+        telemetry->used -= (uint16_t) ((tail + FUEL_GAUGE_TELEMETRY_SIZE - telemetry->tail) % FUEL_GAUGE_TELEMETRY_SIZE);
+        telemetry->tail = tail;
+        telemetry->count--;
+        telemetry->evicted++;
+    }
+
+    for (uint8_t index = 0; index < size; index++) {
+        telemetry->ring[telemetry->head] = record[index];
+        telemetry->head = Advance(telemetry->head, 1);
+    }
+
+    telemetry->used += size;
+    telemetry->last = sample;
+    telemetry->count++;
+}
+
+/**
+* \brief Starts decoding at the oldest sample.
+*/
+bool FuelGaugeTelemetryFirst(const FuelGaugeTelemetry *telemetry,
+                             FuelGaugeTelemetryCursor *cursor)
+{
+    if (telemetry->count == 0)
+        return false;
+
+    cursor->sample = telemetry->base;
+    cursor->index = 0;
+    cursor->position = telemetry->tail;
+
+    return true;
+}
+
+/**
+* \brief Steps the cursor to the next sample.
+*/
+bool FuelGaugeTelemetryNext(const FuelGaugeTelemetry *telemetry,
+                            FuelGaugeTelemetryCursor *cursor)
+{
+    if (cursor->index + 1 >= telemetry->count)
+        return false;
+
+    cursor->position = DecodeRecord(telemetry, cursor->position, &cursor->sample);
+    cursor->index++;
+
+    return true;
+}
+
+/***********************************************************************
+   Static functions.
+***********************************************************************/
+static inline uint8_t EncodeRecord(const FuelGaugeTelemetrySample *previous,
+                                   const FuelGaugeTelemetrySample *sample,
+                                   uint8_t *record)
+{
+    uint8_t mask = 0;
+    uint8_t size = 1;
+
+    size += PutVarint(&record[size], sample->timeMs - previous->timeMs);
+
+    EncodeDelta(record, &size, &mask, FIELD_VOLTAGE, previous->voltage, sample->voltage);
+    EncodeDelta(record, &size, &mask, FIELD_CURRENT, previous->current, sample->current);
+    EncodeDelta(record, &size, &mask, FIELD_TEMPERATURE, previous->temperature, sample->temperature);
+    EncodeDelta(record, &size, &mask, FIELD_RELATIVE_SOC, previous->relativeSoc, sample->relativeSoc);
+    EncodeDelta(record, &size, &mask, FIELD_SOH, previous->soh, sample->soh);
+    EncodeFlips(record, &size, &mask, FIELD_BATTERY_STATUS, previous->batteryStatus, sample->batteryStatus);
+    EncodeFlips(record, &size, &mask, FIELD_OPERATION_STATUS, previous->operationStatus, sample->operationStatus);
+
+    record[0] = mask;
+
+    return size;
+}
+
+// Applies the record at position to sample, returns the position of the next record
+static inline uint16_t DecodeRecord(const FuelGaugeTelemetry *telemetry,
+                                    uint16_t position,
+                                    FuelGaugeTelemetrySample *sample)
+{
+    uint8_t mask = telemetry->ring[position];
+
+    position = Advance(position, 1);
+    sample->timeMs += GetVarint(telemetry, &position);
+
+    if (mask & FIELD_VOLTAGE)
+        sample->voltage += ZigzagDecode(GetVarint(telemetry, &position));
+    if (mask & FIELD_CURRENT)
+        sample->current += ZigzagDecode(GetVarint(telemetry, &position));
+    if (mask & FIELD_TEMPERATURE)
+        sample->temperature += ZigzagDecode(GetVarint(telemetry, &position));
+    if (mask & FIELD_RELATIVE_SOC)
+        sample->relativeSoc += ZigzagDecode(GetVarint(telemetry, &position));
+    if (mask & FIELD_SOH)
+        sample->soh += ZigzagDecode(GetVarint(telemetry, &position));
+    if (mask & FIELD_BATTERY_STATUS)
+        sample->batteryStatus ^= GetVarint(telemetry, &position);
+    if (mask & FIELD_OPERATION_STATUS)
+        sample->operationStatus ^= GetVarint(telemetry, &position);
+
+    return position;
+}
+
+static inline void EncodeDelta(uint8_t *record, uint8_t *size, uint8_t *mask, uint8_t field,
+                               int32_t previous, int32_t value)
+{
+    if (value == previous)
+        return;
+
+    (*mask) |= field;
+    (*size) += PutVarint(&record[*size], ZigzagEncode(value - previous));
+}
+
+static inline void EncodeFlips(uint8_t *record, uint8_t *size, uint8_t *mask, uint8_t field,
+                               uint32_t previous, uint32_t value)
+{
+    if (value == previous)
+        return;
+
+    (*mask) |= field;
+    (*size) += PutVarint(&record[*size], value ^ previous);
+}
+
+// 7 bits per byte, least significant first, top bit set on all but the last
+static inline uint8_t PutVarint(uint8_t *record, uint32_t value)
+{
+    uint8_t size = 0;
+
+    while (value >= VARINT_MORE) {
+        record[size++] = (uint8_t) (value | VARINT_MORE);
+        value >>= 7;
+    }
+
+    record[size++] = (uint8_t) value;
+
+    return size;
+}
+
+static inline uint32_t GetVarint(const FuelGaugeTelemetry *telemetry, uint16_t *position)
+{
+    uint32_t value = 0;
+    uint8_t shift = 0;
+    uint8_t byte;
+
+    do {
+        byte = telemetry->ring[*position];
+        (*position) = Advance(*position, 1);
+
+        value |= (uint32_t) (byte & ~VARINT_MORE) << shift;
+        shift += 7;
+    } while (byte & VARINT_MORE);
+
+    return value;
+}
+
+// Maps small magnitudes of either sign to small codes: 0, -1, 1, -2, ...
+static inline uint32_t ZigzagEncode(int32_t value)
+{
+    return ((uint32_t) value << 1) ^ (uint32_t) (value >> 31);
+}
+
+static inline int32_t ZigzagDecode(uint32_t value)
+{
+    return (int32_t) (value >> 1) ^ -(int32_t) (value & 1);
+}
+
+static inline uint16_t Advance(uint16_t position, uint16_t count)
+{
+    return (uint16_t) ((position + count) % FUEL_GAUGE_TELEMETRY_SIZE);
+}
@@ -0,0 +1,93 @@
+#ifndef SYSTEM_MONITOR_FUEL_GAUGE_TELEMETRY_H_
+#define SYSTEM_MONITOR_FUEL_GAUGE_TELEMETRY_H_
+
+/*
+ * Note:    Long term telemetry in a fixed byte ring. Each sample is stored as
+ *          the difference to the previous one: a mask of the fields that
+ *          changed, then the time step and every changed field as a varint.
+ *          Signed fields are zigzag encoded, status words are stored as the
+ *          bits that flipped. A pack at rest costs 3 bytes per sample instead
+ *          of sizeof(FuelGaugeTelemetrySample).
+ *
+ *          When the ring is full the oldest records are folded into the base
+ *          sample, so the ring always decodes from a complete sample.
+*/
+#include "FuelGauge.h"
+
+#include <stdint.h>
+
+
+#ifndef FUEL_GAUGE_TELEMETRY_SIZE
+#define FUEL_GAUGE_TELEMETRY_SIZE           512  // bytes of encoded records
+#endif
+#define FUEL_GAUGE_TELEMETRY_RECORD_MAX     29   // mask, time and every field at its widest
+
+
+typedef struct {
+    uint32_t timeMs;
+    uint16_t voltage;                   // mV
+    int16_t current;                    // mA
+    uint16_t temperature;               // 0.1 K
+    uint16_t relativeSoc;               // %
+    uint16_t soh;                       // %
+    uint16_t batteryStatus;
+    uint32_t operationStatus;
+} FuelGaugeTelemetrySample;
+
+typedef struct {
+    FuelGaugeTelemetrySample base;      // oldest sample, the records follow it
+    FuelGaugeTelemetrySample last;      // newest sample, the next record is relative to it
+    uint32_t count;                     // samples, including base
+    uint32_t evicted;                   // samples folded away since init
+    uint16_t head;                      // where the next record is written
+    uint16_t tail;                      // oldest record
+    uint16_t used;
+    uint8_t ring[FUEL_GAUGE_TELEMETRY_SIZE];
+} FuelGaugeTelemetry;
+
+/**
+* \brief Streaming decode position, see FuelGaugeTelemetryFirst().
+*/
+typedef struct {
+    FuelGaugeTelemetrySample sample;
+    uint32_t index;
+    uint16_t position;
+} FuelGaugeTelemetryCursor;
+
+
+/**
+* \brief Empties the ring.
+*/
+void FuelGaugeTelemetryInit(FuelGaugeTelemetry *telemetry);
+
+/**
+* \brief Appends a sample taken from a snapshot and the Operation Status word,
+* e.g. from a FuelGaugeScheduler callback.
+*
+* Constant time: at most FUEL_GAUGE_TELEMETRY_RECORD_MAX bytes are encoded
+* and each record is evicted once.
+*/
+void FuelGaugeTelemetryAppend(FuelGaugeTelemetry *telemetry,
+                              uint32_t timeMs,
+                              const FuelGaugeSnapshot *snapshot,
+                              uint32_t operationStatus);
+
+/**
+* \brief Starts decoding at the oldest sample.
+*
+* \return false if the ring is empty.
+*/
+bool FuelGaugeTelemetryFirst(const FuelGaugeTelemetry *telemetry,
+                             FuelGaugeTelemetryCursor *cursor);
+
+/**
+* \brief Steps the cursor to the next sample, in cursor->sample.
+*
+* The cursor is only valid until the next FuelGaugeTelemetryAppend().
+*
+* \return false once the newest sample was reached.
+*/
+bool FuelGaugeTelemetryNext(const FuelGaugeTelemetry *telemetry,
+                            FuelGaugeTelemetryCursor *cursor);
+
+#endif  // SYSTEM_MONITOR_FUEL_GAUGE_TELEMETRY_H_
@@ -13,7 +13,8 @@
 #include <stdint.h>
 
 
-// \todo: consider storing this golden image as bytes instead of ASCII text to avoid doing the conversion in firmware
+// Text form, parsed at runtime by FuelGaugeExecuteGoldenImage. GoldenImageBinary.h holds the same
+// stream compiled by tools/GoldenImageCompiler for FuelGaugeExecuteGoldenImageBinary.
 
 const char goldenImage [] = "W:AA3E0200\n"
                             "C:AA3E020015610201\n"
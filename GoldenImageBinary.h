@@ -0,0 +1,548 @@
+/*
+ * Generated by tools/GoldenImageCompiler from df.fs. Do not edit.
+ *
+ * Record layout is described in GoldenImageFormat.h.
+ */
+
+#ifndef FUEL_GAUGE_GOLDEN_IMAGE_BINARY_H_
+#define FUEL_GAUGE_GOLDEN_IMAGE_BINARY_H_
+
+
+#include "GoldenImageFormat.h"
+
+#include <stdint.h>
+
+
+static const uint8_t goldenImageBinary [] = {
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0xAA, 0x3E, 0x02, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_COMPARE, 0xAA, 0x3E, 0x06, 0x02, 0x00, 0x15, 0x61, 0x02, 0x01,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0xAA, 0x00, 0x02, 0x14, 0x04,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0xAA, 0x00, 0x02, 0x72, 0x36,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0xAA, 0x00, 0x02, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0xAA, 0x00, 0x02, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0xE8, 0x03,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0xAA, 0x00, 0x02, 0x00, 0x0F,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0xE8, 0x03,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x11, 0x02, 0xDE, 0x83,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0xC8, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x40, 0x45, 0x2F, 0x05, 0xC2, 0x28, 0xBF, 0x7F, 0x6A, 0xBC, 0x3E, 0x23, 0x60, 0xD6, 0x48, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x40, 0x20, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x40, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x7A, 0x78, 0x79, 0x30, 0x31, 0x32, 0x33, 0x34,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x40, 0x35, 0x20, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x40, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x7A, 0x78, 0x79, 0x30, 0x31, 0x32, 0x33,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x40, 0x34, 0x35, 0x20, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x40, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x7A, 0x78, 0x79, 0x30, 0x31, 0x32,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x40, 0x33, 0x34, 0x35, 0x00, 0x00, 0x3A, 0x22, 0x00, 0x00, 0x21, 0x00, 0x01, 0x00, 0x11, 0x54, 0x65,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x40, 0x78, 0x61, 0x73, 0x20, 0x49, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x40, 0x00, 0x00, 0x08, 0x62, 0x71, 0x32, 0x37, 0x7A, 0x35, 0x36, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x4C, 0x49, 0x4F, 0x4E, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x41, 0x00, 0x00, 0x0F, 0x01, 0x4E, 0x00, 0x4D, 0x00, 0x59, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x4F, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x41, 0x51, 0x00, 0x53, 0x00, 0x54, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x80, 0x00, 0x57, 0x01, 0xD3, 0x03,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x41, 0x55, 0x00, 0x0C, 0x01, 0x4D, 0x00, 0x4C, 0x00, 0x58, 0x00, 0x4E, 0x00, 0x52, 0x00, 0x4E, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x41, 0x50, 0x00, 0x52, 0x00, 0x53, 0x00, 0x6E, 0x00, 0x6E, 0x00, 0x7E, 0x00, 0x53, 0x01, 0xC6, 0x03,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x41, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x31, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5B, 0x10, 0x0B,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x41, 0x01, 0xF3, 0xFD, 0x44, 0xFF, 0x00, 0x00, 0xA0, 0x00, 0xC1, 0x00, 0x26, 0xFA, 0xA2, 0xFD, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x42, 0x50, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x42, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x43, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0xEC, 0xD8, 0x00, 0x00, 0x00, 0x64, 0x5A, 0x08, 0x64, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x43, 0x00, 0x00, 0x68, 0x10, 0x68, 0x10, 0x68, 0x10, 0x68, 0x10, 0x68, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x44, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x44, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x44, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x44, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x44, 0xAC, 0xC9, 0x2F, 0x1B, 0x00, 0x00, 0x2F, 0x1B, 0xD9, 0xBB, 0x8A, 0x72, 0xAA, 0x9C, 0x8C, 0x74,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x44, 0xB0, 0x04, 0xDB, 0xFE, 0x28, 0x02, 0xB9, 0xF4, 0xEF, 0x11, 0xB7, 0x2D, 0xB7, 0x2D, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x44, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x03, 0x09, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x44, 0x57, 0x24, 0x5B, 0x10, 0x2B, 0x10, 0xFE, 0x0F, 0xF4, 0x0F, 0xEA, 0x0F, 0xE5, 0x0F, 0xDF, 0x0F,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x44, 0xC8, 0x0F, 0xB4, 0x0F, 0x93, 0x0F, 0x76, 0x0F, 0x5F, 0x0F, 0x48, 0x0F, 0x35, 0x0F, 0x21, 0x0F,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x44, 0xFC, 0x0E, 0xDD, 0x0E, 0xC4, 0x0E, 0xAB, 0x0E, 0x94, 0x0E, 0x7D, 0x0E, 0x67, 0x0E, 0x51, 0x0E,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x44, 0x43, 0x0E, 0x31, 0x0E, 0x1E, 0x0E, 0x0A, 0x0E, 0xEF, 0x0D, 0xD4, 0x0D, 0xB0, 0x0D, 0x93, 0x0D,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x44, 0x80, 0x0D, 0x63, 0x0D, 0x49, 0x0D, 0x29, 0x0D, 0xC8, 0x0C, 0x6B, 0x0C, 0x01, 0x0C, 0x65, 0x0B,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x44, 0xC7, 0x09, 0xEE, 0x0F, 0xC7, 0x0F, 0xAC, 0xFD, 0xFE, 0xFE, 0xFE, 0x00, 0xF7, 0x00, 0x08, 0x01,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x44, 0xF3, 0x00, 0x29, 0x01, 0x77, 0x00, 0xF3, 0xFF, 0xC9, 0xFF, 0xAE, 0xFF, 0x25, 0x00, 0x2E, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x44, 0xA6, 0x00, 0x6E, 0x00, 0xA4, 0x00, 0x59, 0x01, 0x09, 0x02, 0x4F, 0x02, 0x09, 0x02, 0xE8, 0x01,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x45, 0xBD, 0x01, 0xE7, 0x01, 0x67, 0x00, 0x1F, 0xFF, 0xBD, 0xFC, 0xD9, 0xFA, 0x77, 0xFB, 0xBF, 0xFB,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x45, 0x28, 0xFC, 0x09, 0xFD, 0x3F, 0xFE, 0xDD, 0xFE, 0x01, 0xFC, 0x05, 0xF7, 0x25, 0xF7, 0x5C, 0xF6,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x45, 0x96, 0xFB, 0x69, 0xE4, 0x31, 0xF3, 0xA2, 0xFF, 0xAC, 0xFF, 0x98, 0xFF, 0x7F, 0xFF, 0xAA, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x45, 0xAF, 0xFF, 0xAC, 0xFF, 0xE3, 0xFF, 0xE4, 0xFF, 0x4F, 0x00, 0x0D, 0x00, 0xF7, 0xFF, 0x13, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x45, 0x33, 0x00, 0xBF, 0xFF, 0xF4, 0xFE, 0xFC, 0xFE, 0xF3, 0xFE, 0x4F, 0xFF, 0x1C, 0xFF, 0x2B, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x45, 0xCE, 0xFE, 0x16, 0xFF, 0x1E, 0xFF, 0x16, 0xFF, 0x75, 0xFF, 0x6D, 0xFF, 0x2A, 0xFF, 0x52, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x45, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x45, 0xF4, 0x01, 0x1E, 0x3C, 0x00, 0x10, 0x0E, 0x0A, 0x00, 0x46, 0x32, 0x0F, 0x05, 0x0F, 0x20, 0x03,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x45, 0x02, 0x0F, 0x04, 0x04, 0x76, 0xFE, 0xE8, 0xF2, 0x00, 0x00, 0x0A, 0x32, 0x00, 0x64, 0x00, 0x50,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x45, 0x46, 0x50, 0x46, 0x0A, 0x90, 0x01, 0x64, 0x00, 0x28, 0x00, 0x19, 0xDC, 0x5C, 0x60, 0x19, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x45, 0x01, 0x00, 0x14, 0x00, 0x05, 0x00, 0x14, 0x00, 0x23, 0x03, 0x08, 0x07, 0x25, 0x5A, 0x0F, 0x1E,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x46, 0x60, 0x05, 0x82, 0x14, 0x05, 0xC8, 0x00, 0x2C, 0x01, 0xC8, 0x00, 0xF0, 0x0A, 0x02, 0xC8, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x46, 0xF0, 0x0A, 0x28, 0x32, 0x00, 0x32, 0x00, 0x20, 0x1C, 0x32, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0x7F,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x46, 0xE8, 0x03, 0x0A, 0x00, 0x50, 0x46, 0x64, 0x00, 0x80, 0x43, 0x90, 0x01, 0x0A, 0xC8, 0x00, 0x88,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x46, 0x13, 0x96, 0x00, 0x32, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x32, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x46, 0x20, 0x08, 0x00, 0x50, 0x00, 0x96, 0x00, 0xAF, 0x00, 0x0A, 0x0F, 0x94, 0x11, 0x30, 0x11, 0xC4,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x46, 0x09, 0x28, 0x0A, 0x3C, 0x37, 0x00, 0x05, 0x01, 0x07, 0xF0, 0x0A, 0x0A, 0x00, 0x05, 0x14, 0x01,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x46, 0x05, 0x00, 0x02, 0x0C, 0xFE, 0x32, 0x38, 0x31, 0xB8, 0x11, 0x10, 0x0E, 0x5A, 0x0A, 0x8C, 0x0C,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x46, 0x8C, 0xB8, 0x0B, 0x1C, 0x0C, 0x00, 0x05, 0x68, 0x10, 0x04, 0x10, 0x64, 0x5F, 0x80, 0x0C, 0xE4,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x46, 0x0C, 0x06, 0x08, 0x68, 0x10, 0x04, 0x10, 0x64, 0x5F, 0xFE, 0xF5, 0xFE, 0x09, 0x3F, 0x00, 0x01,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x46, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x96, 0x00, 0x64, 0x00, 0x14,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x46, 0x64, 0x3C, 0xAC, 0x0D, 0xD0, 0x07, 0x64, 0x00, 0xE8, 0x03, 0x00, 0x00, 0x00, 0x0A, 0x14, 0x19,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x46, 0x2D, 0x37, 0x01, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x46, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8, 0x0B, 0xB8,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x46, 0x0B, 0x58, 0x00, 0x2C, 0x00, 0xC4, 0x09, 0x54, 0x0B, 0x10, 0x0E, 0xA0, 0x0F, 0x00, 0x32, 0x4B,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x46, 0x01, 0x32, 0x00, 0x5F, 0x38, 0x22, 0x38, 0x22, 0x38, 0x22, 0x38, 0x22, 0x0A, 0x00, 0x0A, 0x96,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x46, 0x00, 0x50, 0x70, 0x44, 0x70, 0x44, 0x70, 0x44, 0x70, 0x44, 0x28, 0x00, 0x14, 0x5E, 0x01, 0x3C,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x47, 0xA8, 0x66, 0xA8, 0x66, 0xA8, 0x66, 0xA8, 0x66, 0x46, 0x00, 0x28, 0x01, 0x0A, 0xA0, 0x0C, 0x68,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x47, 0x10, 0x2C, 0x01, 0x19, 0x00, 0xB8, 0x0B, 0x18, 0x01, 0x19, 0x00, 0x64, 0x00, 0x30, 0x11, 0x28,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x47, 0x0C, 0x01, 0x10, 0x00, 0xFA, 0x02, 0x00, 0x40, 0x00, 0x01, 0x00, 0x05, 0x05, 0x00, 0x00, 0x0A,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x47, 0x5F, 0x5A, 0x50, 0x32, 0x14, 0x0A, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x20, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x30, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x50, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x60, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x70, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x80, 0x4F, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x31, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5B, 0x10, 0x0B,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0x90, 0x4F, 0x01, 0xF3, 0xFD, 0x44, 0xFF, 0x00, 0x00, 0xA0, 0x00, 0xC1, 0x00, 0x26, 0xFA, 0xA2, 0xFD, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xA0, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xB0, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xC0, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xD0, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xE0, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x0F, 0x13, 0x12, 0xF0, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0x02, 0x00,
+    FUEL_GAUGE_IMAGE_OP_COMPARE, 0x16, 0x14, 0x02, 0xCF, 0x1A,
+    FUEL_GAUGE_IMAGE_OP_WRITE, 0x16, 0x08, 0x01, 0x11,
+    FUEL_GAUGE_IMAGE_OP_DELAY, 0xA0, 0x0F,
+};
+
+// 6731 bytes
+
+
+#endif
@@ -0,0 +1,25 @@
+/*
+ * GoldenImageFormat.h
+ *
+ * Binary form of a df.fs flash stream, as produced by tools/GoldenImageCompiler.
+ * The stream is a sequence of records, each starting with an opcode byte:
+ *
+ *  W/C record:     opcode, 8-bit I2C address, register, length, payload[length]
+ *  X record:       opcode, delay in ms (little-endian uint16_t)
+ *
+ * The opcodes are the ASCII letters of the matching df.fs lines.
+ */
+
+#ifndef FUEL_GAUGE_GOLDEN_IMAGE_FORMAT_H_
+#define FUEL_GAUGE_GOLDEN_IMAGE_FORMAT_H_
+
+
+#define FUEL_GAUGE_IMAGE_OP_WRITE           0x57 // 'W': write payload to register
+#define FUEL_GAUGE_IMAGE_OP_COMPARE         0x43 // 'C': read register and compare with payload
+#define FUEL_GAUGE_IMAGE_OP_DELAY           0x58 // 'X': wait before the next record
+
+#define FUEL_GAUGE_IMAGE_RECORD_HEADER      3    // address, register, length
+#define FUEL_GAUGE_IMAGE_DELAY_SIZE         2
+
+
+#endif
@@ -0,0 +1,23 @@
+/*
+ * CommonDefinesAndMacros.h
+ *
+ * Host versions of the platform macros used by the driver.
+ */
+
+#ifndef HOST_COMMON_DEFINES_AND_MACROS_H_
+#define HOST_COMMON_DEFINES_AND_MACROS_H_
+
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define configASSERT(x)         assert(x)
+#define ARRAY_COUNT(a)          (sizeof(a) / sizeof((a)[0]))
+#define BIT_IS_SET(value, bit)  ((((value) >> (bit)) & 1) != 0)
+
+
+#endif
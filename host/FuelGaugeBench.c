@@ -0,0 +1,903 @@
+/*
+ * FuelGaugeBench.c
+ *
+ * Bus cost of every FuelGauge.h call, measured against the simulated gauge at
+ * 100 kHz and 400 kHz. Each case runs on a freshly initialized gauge and
+ * driver so the numbers do not depend on the order of the cases.
+ *
+ * Usage: fuelgauge-bench [--baseline file.json]
+ *
+ * Results are written to stdout as JSON, one case per line. With a baseline
+ * (a previous output) the run fails if any case got more expensive or stopped
+ * succeeding.
+ */
+
+#include "FuelGauge.h"
+#include "FuelGaugeScheduler.h"
+#include "FuelGaugeLinuxI2c.h"
+#include "FuelGaugeSim.h"
+#include "GoldenImageBinary.h"
+
+#include <errno.h>
+#include <linux/i2c-dev.h>
+#include <stdio.h>
+#include <string.h>
+
+
+#define BENCH_ASYNC_IDLE_US     10
+#define BENCH_NAME_SIZE         40
+#define BENCH_MAX_RESULTS       128
+#define BENCH_SCHEDULER_MS      60000
+#define BENCH_RACK_GAUGES       21      // with one more message, the pairs straddle I2C_RDWR_IOCTL_MAX_MSGS
+
+
+typedef struct {
+    const char *name;
+    void (*setup)(void);                // untimed preconditions
+    bool (*run)(void);
+} BenchCase;
+
+typedef struct {
+    char name[BENCH_NAME_SIZE];
+    uint32_t khz;
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t opens;
+    uint32_t closes;
+    uint32_t timeUs;
+    bool ok;
+} BenchResult;
+
+extern const char goldenImage [];
+
+static FuelGaugeSim sim;
+static FuelGaugeLinuxI2c linuxBus;
+static FuelGaugeSim rackSims[BENCH_RACK_GAUGES];            // further gauges on the i2c-dev bus, from 0x56 on
+static uint8_t programmedFlash[FUEL_GAUGE_SIM_DF_SIZE];     // data flash once the golden image ran
+
+static bool asyncPending = false;
+static bool asyncResult = false;
+
+
+/**
+ *  Setups
+ */
+static void SetupUnsealed(void)
+{
+    sim.security = FUEL_GAUGE_SIM_UNSEALED;
+}
+
+static void SetupFullAccess(void)
+{
+    sim.security = FUEL_GAUGE_SIM_FULL_ACCESS;
+}
+
+static void SetupImpedanceDisabled(void)
+{
+    sim.security = FUEL_GAUGE_SIM_UNSEALED;
+    sim.manufacturingStatus &= ~(1 << 3);
+}
+
+static void SetupRomMode(void)
+{
+    sim.romMode = true;
+}
+
+static void SetupOneNack(void)
+{
+    sim.nackCount = 1;
+}
+
+static void SetupNackedResponse(void)
+{
+    // the MAC command write goes through, the response read is NACKed once
+    sim.nackSkip = 1;
+    sim.nackCount = 1;
+}
+
+static void SetupCorruptedResponse(void)
+{
+    sim.corruptCount = 1;
+}
+
+static void SetupOpenFailure(void)
+{
+    sim.openFailCount = 1;
+}
+
+static void SetupDeadBus(void)
+{
+    sim.nackCount = UINT32_MAX;
+}
+
+static void SetupProgrammed(void)
+{
+    FuelGaugeExecuteGoldenImage();
+    memcpy(programmedFlash, sim.dataFlash, sizeof(programmedFlash));
+    sim.security = FUEL_GAUGE_SIM_FULL_ACCESS;
+}
+
+static void SetupUnprogrammed(void)
+{
+    uint8_t initialFlash[sizeof(sim.dataFlash)];
+
+    memcpy(initialFlash, sim.dataFlash, sizeof(initialFlash));
+    SetupProgrammed();
+    memcpy(sim.dataFlash, initialFlash, sizeof(initialFlash));
+}
+
+static void SetupOneRowChanged(void)
+{
+    SetupProgrammed();
+    sim.dataFlash[0x40] ^= 0x01;
+}
+
+
+/**
+ *  Cases
+ */
+static bool RunGetControlStatus(void)
+{
+    uint16_t value;
+    return FuelGaugeGetControlStatus(&value);
+}
+
+static bool RunGetVoltage(void)
+{
+    uint16_t value;
+    return FuelGaugeGetVoltage(&value);
+}
+
+static bool RunGetBatteryStatus(void)
+{
+    uint16_t value;
+    return FuelGaugeGetBatteryStatus(&value);
+}
+
+static bool RunGetManufacturingStatus(void)
+{
+    uint16_t value;
+    return FuelGaugeGetManufacturingStatus(&value);
+}
+
+static bool RunGetCurrent(void)
+{
+    int16_t value;
+    return FuelGaugeGetCurrent(&value);
+}
+
+static bool RunGetRemainingCapacity(void)
+{
+    uint16_t value;
+    return FuelGaugeGetRemainingCapacity(&value);
+}
+
+static bool RunGetFullChargeCapacity(void)
+{
+    uint16_t value;
+    return FuelGaugeGetFullChargeCapacity(&value);
+}
+
+static bool RunGetRelativeSoc(void)
+{
+    uint16_t value;
+    return FuelGaugeGetRelativeSoc(&value);
+}
+
+static bool RunGetSoh(void)
+{
+    uint16_t value;
+    return FuelGaugeGetSoh(&value);
+}
+
+static bool RunGetCapacity(void)
+{
+    uint16_t value;
+    return FuelGaugeGetCapacity(&value);
+}
+
+static bool RunReadSnapshot(void)
+{
+    FuelGaugeSnapshot snapshot;
+    return FuelGaugeReadSnapshot(&snapshot);
+}
+
+static bool RunGetOperationStatus(void)
+{
+    uint32_t value;
+    return FuelGaugeGetOperationStatus(&value);
+}
+
+static bool RunGetGaugingStatus(void)
+{
+    uint32_t value;
+    return FuelGaugeGetGaugingStatus(&value);
+}
+
+static bool RunGetUpdateStatus(void)
+{
+    uint8_t value;
+    return FuelGaugeGetUpdateStatus(&value);
+}
+
+static bool RunGetVoltageFailing(void)
+{
+    uint16_t value;
+
+    // succeeds when the call gives up with a transfer error
+    return (FuelGaugeGetVoltage(&value) == false && FuelGaugeGetLastError() == FUEL_GAUGE_ERROR_TRANSFER);
+}
+
+static bool RunGetChargingStatus(void)
+{
+    uint32_t value;
+    return FuelGaugeGetChargingStatus(&value);
+}
+
+static bool RunGetChemId(void)
+{
+    uint16_t value;
+    return FuelGaugeGetChemId(&value);
+}
+
+static bool RunReadMacFirmwareVersion(void)
+{
+    uint8_t value[11];
+    return FuelGaugeReadMac(FUEL_GAUGE_MAC_FIRMWARE_VERSION, value);
+}
+
+static bool RunReadMacDaStatus1(void)
+{
+    uint16_t value[16];
+    return FuelGaugeReadMac(FUEL_GAUGE_MAC_DA_STATUS1, value);
+}
+
+static bool RunReadMacs(void)
+{
+    static const FuelGaugeMac macs [] = {
+        FUEL_GAUGE_MAC_OPERATION_STATUS,
+        FUEL_GAUGE_MAC_GAUGING_STATUS,
+        FUEL_GAUGE_MAC_CHARGING_STATUS,
+    };
+    uint32_t operationStatus, gaugingStatus, chargingStatus;
+    void *const values [] = {&operationStatus, &gaugingStatus, &chargingStatus};
+
+    return FuelGaugeReadMacs(macs, values, sizeof(macs) / sizeof(macs[0]));
+}
+
+static bool RunReadDiagnostics(void)
+{
+    FuelGaugeDiagnostics diagnostics;
+    return FuelGaugeReadDiagnostics(&diagnostics);
+}
+
+static bool RunDataFlashReadModifyWrite(void)
+{
+    // toggles a Power Config bit, then reads the parameter next to it
+    uint8_t powerConfig[2];
+    uint8_t neighbour[2];
+
+    bool result = FuelGaugeDataFlashRead(0x4643, powerConfig, sizeof(powerConfig));
+
+    powerConfig[0] ^= 0x01;
+    result &= FuelGaugeDataFlashWrite(0x4643, powerConfig, sizeof(powerConfig));
+    result &= FuelGaugeDataFlashRead(0x4641, neighbour, sizeof(neighbour));
+
+    return result;
+}
+
+// below and across the end of data flash: rejected before any transfer
+static bool RunDataFlashOutOfRange(void)
+{
+    uint32_t transactions = sim.stats.transactions;
+    uint8_t data[4] = {0};
+    FuelGaugeDataFlashBatch batch;
+
+    bool rejected = (FuelGaugeDataFlashRead(0x0054, data, sizeof(data)) == false);
+    rejected &= (FuelGaugeDataFlashRead(0x3FFE, data, sizeof(data)) == false);
+    rejected &= (FuelGaugeDataFlashWrite(0x5FFE, data, sizeof(data)) == false);
+
+    FuelGaugeDataFlashBatchInit(&batch);
+    rejected &= (FuelGaugeDataFlashBatchSet(&batch, 0x5FFE, data, sizeof(data)) == false);
+    rejected &= (batch.count == 0);
+
+    return (rejected == true && sim.stats.transactions == transactions);
+}
+
+static bool RunDataFlashBatch(void)
+{
+    // three parameters sharing one block, written and verified once
+    static const uint8_t powerConfig [] = {0x01, 0x00};
+    static const uint8_t designCapacity [] = {0xd0, 0x07};
+    static const uint8_t threshold [] = {0x64};
+    FuelGaugeDataFlashBatch batch;
+
+    FuelGaugeDataFlashBatchInit(&batch);
+    FuelGaugeDataFlashBatchSet(&batch, 0x4643, powerConfig, sizeof(powerConfig));
+    FuelGaugeDataFlashBatchSet(&batch, 0x4650, designCapacity, sizeof(designCapacity));
+    FuelGaugeDataFlashBatchSet(&batch, 0x4655, threshold, sizeof(threshold));
+
+    return (FuelGaugeDataFlashBatchCommit(&batch) == ERROR_NONE);
+}
+
+static bool RunSetThresholds(void)
+{
+    static const FuelGaugeThresholds thresholds = {4100, 4050, 3300, 3350, 45, 40, 0, 5};
+    return FuelGaugeSetThresholds(&thresholds);
+}
+
+static bool RunInterruptServiceIdle(void)
+{
+    uint8_t status;
+    return FuelGaugeInterruptService(&status) && status == 0;
+}
+
+static void SetupVoltageHigh(void)
+{
+    FuelGaugeSimSetRegister(&sim, 0x08, 5100);
+}
+
+static bool RunInterruptServicePending(void)
+{
+    uint8_t status;
+
+    // what the GPOUT pin handler would do
+    if (sim.interruptPin == true)
+        FuelGaugeInterruptNotify();
+
+    return FuelGaugeInterruptService(&status) && status == FUEL_GAUGE_INT_VOLT_HI;
+}
+
+static bool RunEnableImpedanceTracking(void)
+{
+    return FuelGaugeEnableImpedanceTracking();
+}
+
+static bool RunDisableImpedanceTracking(void)
+{
+    // returns whether tracking is still enabled
+    return (FuelGaugeDisableImpedanceTracking() == false);
+}
+
+static bool RunEnableLifetimeTracking(void)
+{
+    return FuelGaugeEnableLifetimeTracking();
+}
+
+static bool RunDisableLifetimeTracking(void)
+{
+    FuelGaugeDisableLifetimeTracking();
+    return true;
+}
+
+static bool RunReset(void)
+{
+    return FuelGaugeReset();
+}
+
+static bool RunUnseal(void)
+{
+    return FuelGaugeUnseal();
+}
+
+static bool RunFullAccess(void)
+{
+    return FuelGaugeFullAccess();
+}
+
+static bool RunSeal(void)
+{
+    return FuelGaugeSeal();
+}
+
+static bool RunResetLifetimeHistory(void)
+{
+    return FuelGaugeResetLifetimeHistory();
+}
+
+static bool RunExitRomMode(void)
+{
+    return FuelGaugeExitRomMode();
+}
+
+static bool RunSession(void)
+{
+    uint16_t value;
+    bool result = FuelGaugeBeginSession();
+
+    result &= FuelGaugeGetVoltage(&value);
+    result &= FuelGaugeGetRelativeSoc(&value);
+    result &= FuelGaugeGetRemainingCapacity(&value);
+
+    FuelGaugeEndSession();
+
+    return result;
+}
+
+static bool RunCachedReads(void)
+{
+    static const FuelGaugeCacheConfig config = {
+        .getTimeMs = FuelGaugeSimGetTimeMs,
+        .ttlMs = {1000, 1000},
+    };
+    FuelGaugeCacheStats stats;
+    uint16_t value;
+
+    FuelGaugeCacheEnable(&config);
+    FuelGaugeCacheInvalidate();
+
+    bool result = FuelGaugeGetVoltage(&value);
+    result &= FuelGaugeGetVoltage(&value);
+
+    FuelGaugeCacheGetStats(&stats);
+    FuelGaugeCacheDisable();
+
+    return (result == true && stats.hits[FUEL_GAUGE_CACHE_STANDARD] == 1);
+}
+
+static void SetupHeavyLoad(void)
+{
+    FuelGaugeSimSetRegister(&sim, 0x0C, (uint16_t) -5000);
+}
+
+// One minute of scheduler polling, sleeping between runs as a task would
+static bool RunSchedulerMinute(void)
+{
+    static const FuelGaugeSchedulerConfig config = {
+        .getTimeMs = FuelGaugeSimGetTimeMs,
+        .bounds = {
+            [FUEL_GAUGE_POLL_SNAPSHOT] = {1000, 10000},
+            [FUEL_GAUGE_POLL_STATUS] = {2000, 30000},
+            [FUEL_GAUGE_POLL_DIAGNOSTICS] = {10000, 60000},
+        },
+        .fullLoadCurrentMa = 3000,
+        .fullSocSlopePerHour = 60,
+    };
+    static FuelGaugeScheduler scheduler;
+    uint32_t endMs = FuelGaugeSimGetTimeMs() + BENCH_SCHEDULER_MS;
+
+    FuelGaugeSchedulerInit(&scheduler, FuelGaugeGetDefaultDevice(), &config);
+
+    while ((int32_t) (endMs - FuelGaugeSimGetTimeMs()) > 0)
+        FuelGaugeSimDelayUs(FuelGaugeSchedulerRun(&scheduler) * 1000);
+
+    bool result = true;
+
+    for (uint8_t group = 0; group < FUEL_GAUGE_POLL_GROUP_COUNT; group++)
+        result &= scheduler.valid[group];
+
+    return result;
+}
+
+// ioctl shim: runs I2C_RDWR messages against the simulated gauge
+static int SimIoctl(int fd, unsigned long request, void *arg)
+{
+    struct i2c_rdwr_ioctl_data *transfer = arg;
+
+    (void) fd;
+
+    if (request != I2C_RDWR) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    for (uint32_t index = 0; index < transfer->nmsgs; index++) {
+        const struct i2c_msg *message = &transfer->msgs[index];
+        const struct i2c_msg *next = (index + 1 < transfer->nmsgs) ? &transfer->msgs[index + 1] : NULL;
+        uint32_t rack = message->addr - (sim.address + 1);
+        FuelGaugeSim *gauge = (rack < BENCH_RACK_GAUGES) ? &rackSims[rack] : &sim;
+        bool result = false;
+
+        // a register write followed by a read is a register read with a repeated start
+        if ((message->flags & I2C_M_RD) == 0 && message->len == 1
+            && next != NULL && (next->flags & I2C_M_RD) != 0 && next->addr == message->addr) {
+            result = FuelGaugeSimRead(gauge, message->addr, message->buf[0], next->buf, next->len);
+            index++;
+        } else if ((message->flags & I2C_M_RD) == 0) {
+            result = FuelGaugeSimWrite(gauge, message->addr, message->buf, message->len);
+        }
+
+        if (result == false) {
+            errno = EREMOTEIO;
+            return -1;
+        }
+    }
+
+    return transfer->nmsgs;
+}
+
+static void SetupLinuxI2c(void)
+{
+    FuelGaugeLinuxI2cInit(&linuxBus, 0, SimIoctl);
+    FuelGaugeLinuxI2cSelect(&linuxBus);
+    // an i2c-dev adapter is always open
+    sim.busOpen = true;
+}
+
+// Runs a case through the i2c-dev backend, which must take one ioctl per transaction
+static bool RunOverLinuxI2c(bool (*run)(void))
+{
+    uint32_t transactions = sim.stats.transactions;
+
+    FuelGaugeGetDefaultDevice()->twi = FuelGaugeLinuxI2cGetTwi();
+    linuxBus.syscalls = 0;
+    // the kernel sets the adapter speed, the driver's is only a request
+    sim.speed = FuelGaugeGetDefaultDevice()->speed;
+
+    bool result = run();
+
+    return (result == true && linuxBus.syscalls == sim.stats.transactions - transactions);
+}
+
+static bool RunLinuxI2cGetVoltage(void)
+{
+    return RunOverLinuxI2c(RunGetVoltage);
+}
+
+static bool RunLinuxI2cGetChemId(void)
+{
+    return RunOverLinuxI2c(RunGetChemId);
+}
+
+static bool RunLinuxI2cReadDiagnostics(void)
+{
+    return RunOverLinuxI2c(RunReadDiagnostics);
+}
+
+static void SetupLinuxI2cRack(void)
+{
+    SetupLinuxI2c();
+
+    for (uint8_t index = 0; index < BENCH_RACK_GAUGES; index++) {
+        FuelGaugeSimInit(&rackSims[index]);
+        rackSims[index].address = sim.address + 1 + index;
+        rackSims[index].busOpen = true;
+        FuelGaugeSimSetRegister(&rackSims[index], 0x08, 3700 + index);
+    }
+}
+
+// AtRate of the first gauge, then the voltage of every rack gauge, batched
+static bool RunLinuxI2cRackVoltages(void)
+{
+    static uint8_t atRate [] = {0x02, 0x00, 0x00};
+    static uint8_t voltageRegister = 0x08;
+    struct i2c_msg messages[1 + 2 * BENCH_RACK_GAUGES];
+    uint16_t voltages[BENCH_RACK_GAUGES];
+    bool result;
+
+    messages[0] = (struct i2c_msg) {.addr = sim.address, .flags = 0, .len = sizeof(atRate), .buf = atRate};
+
+    for (uint8_t index = 0; index < BENCH_RACK_GAUGES; index++) {
+        uint16_t address = rackSims[index].address;
+
+        messages[1 + 2 * index] = (struct i2c_msg) {.addr = address, .flags = 0, .len = 1, .buf = &voltageRegister};
+        messages[2 + 2 * index] = (struct i2c_msg) {.addr = address, .flags = I2C_M_RD,
+                                                    .len = sizeof(voltages[index]),
+                                                    .buf = (uint8_t *) &voltages[index]};
+    }
+
+    linuxBus.syscalls = 0;
+    sim.speed = FuelGaugeGetDefaultDevice()->speed;
+
+    for (uint8_t index = 0; index < BENCH_RACK_GAUGES; index++)
+        rackSims[index].speed = sim.speed;
+
+    result = FuelGaugeLinuxI2cTransfer(&linuxBus, messages, sizeof(messages) / sizeof(messages[0]));
+
+    for (uint8_t index = 0; index < BENCH_RACK_GAUGES; index++)
+        result &= (voltages[index] == 3700 + index);
+
+    return (result == true && linuxBus.syscalls == 2);
+}
+
+static bool RunExecuteGoldenImage(void)
+{
+    return (FuelGaugeExecuteGoldenImage() == ERROR_NONE);
+}
+
+static bool RunExecuteGoldenImageStream(void)
+{
+    FuelGaugeImageMemory memory = {
+        .text = goldenImage,
+        .size = strlen(goldenImage),
+    };
+    FuelGaugeImageReader reader = {
+        .read = FuelGaugeImageMemoryRead,
+        .rewind = FuelGaugeImageMemoryRewind,
+        .context = &memory,
+    };
+
+    return (FuelGaugeExecuteGoldenImageStream(&reader) == ERROR_NONE);
+}
+
+static bool ExecuteGoldenImageIncremental(FuelGaugeImageStats *stats)
+{
+    FuelGaugeImageMemory memory = {
+        .text = goldenImage,
+        .size = strlen(goldenImage),
+    };
+    FuelGaugeImageReader reader = {
+        .read = FuelGaugeImageMemoryRead,
+        .rewind = FuelGaugeImageMemoryRewind,
+        .context = &memory,
+    };
+
+    // the gauge must end up with the same data flash as after a full run
+    return (FuelGaugeExecuteGoldenImageIncremental(&reader, stats) == ERROR_NONE
+            && memcmp(sim.dataFlash, programmedFlash, sizeof(programmedFlash)) == 0);
+}
+
+static bool RunExecuteGoldenImageIncremental(void)
+{
+    FuelGaugeImageStats stats;
+
+    return (ExecuteGoldenImageIncremental(&stats) == true
+            && stats.blocksSkipped == 0);
+}
+
+static bool RunExecuteGoldenImageIncrementalUnchanged(void)
+{
+    FuelGaugeImageStats stats;
+
+    // no ROM mode at all: the gauge stays in firmware and keeps its full access
+    return (ExecuteGoldenImageIncremental(&stats) == true
+            && stats.blocksWritten == 0
+            && sim.security == FUEL_GAUGE_SIM_FULL_ACCESS);
+}
+
+static bool RunExecuteGoldenImageBinary(void)
+{
+    return (FuelGaugeExecuteGoldenImageBinary(goldenImageBinary, sizeof(goldenImageBinary)) == ERROR_NONE);
+}
+
+static bool StartAsyncRead(uint8_t address, const uint8_t *reg, uint8_t regSize, void *data, uint8_t size)
+{
+    asyncResult = FuelGaugeSimGetTwi()->read(address, reg, regSize, data, size);
+    asyncPending = true;
+
+    return true;
+}
+
+static bool StartAsyncWrite(uint8_t address, const uint8_t *reg, uint8_t regSize, const uint8_t *data, uint8_t size)
+{
+    asyncResult = FuelGaugeSimGetTwi()->write(address, reg, regSize, data, size);
+    asyncPending = true;
+
+    return true;
+}
+
+static bool RunAsyncPrimedRead(void)
+{
+    static const FuelGaugeTwiAsync twiAsync = {
+        .startRead = StartAsyncRead,
+        .startWrite = StartAsyncWrite,
+    };
+    static const uint8_t chemIdCommand [] = {0x06, 0x00};
+    FuelGaugeDevice *device = FuelGaugeGetDefaultDevice();
+    FuelGaugeRequest request;
+    uint8_t value[4];
+
+    FuelGaugeDeviceInitAsync(device, &twiAsync);
+    FuelGaugeRequestInitPrimedRead(&request, 0x3E, chemIdCommand, sizeof(chemIdCommand), value, sizeof(value));
+    FuelGaugeDevSubmitRequest(device, &request);
+
+    // complete transfers as the interrupt would, idle while the bus is held
+    while (FuelGaugeDevProcessRequests(device) == true) {
+        if (asyncPending == true) {
+            asyncPending = false;
+            FuelGaugeDevTransferComplete(device, asyncResult);
+        } else {
+            FuelGaugeSimDelayUs(BENCH_ASYNC_IDLE_US);
+        }
+    }
+
+    return (request.state == FUEL_GAUGE_REQUEST_DONE);
+}
+
+
+static const BenchCase cases [] = {
+    {"GetControlStatus", NULL, RunGetControlStatus},
+    {"GetVoltage", NULL, RunGetVoltage},
+    {"GetBatteryStatus", NULL, RunGetBatteryStatus},
+    {"GetManufacturingStatus", NULL, RunGetManufacturingStatus},
+    {"GetCurrent", NULL, RunGetCurrent},
+    {"GetRemainingCapacity", NULL, RunGetRemainingCapacity},
+    {"GetFullChargeCapacity", NULL, RunGetFullChargeCapacity},
+    {"GetRelativeSoc", NULL, RunGetRelativeSoc},
+    {"GetSoh", NULL, RunGetSoh},
+    {"GetCapacity", NULL, RunGetCapacity},
+    {"ReadSnapshot", NULL, RunReadSnapshot},
+    {"GetOperationStatus", NULL, RunGetOperationStatus},
+    {"GetGaugingStatus", NULL, RunGetGaugingStatus},
+    {"GetUpdateStatus", SetupUnsealed, RunGetUpdateStatus},
+    {"GetChargingStatus", NULL, RunGetChargingStatus},
+    {"GetChemId", NULL, RunGetChemId},
+    {"ReadMacFirmwareVersion", NULL, RunReadMacFirmwareVersion},
+    {"ReadMacDaStatus1", NULL, RunReadMacDaStatus1},
+    {"ReadMacs3Status", NULL, RunReadMacs},
+    {"ReadDiagnostics", NULL, RunReadDiagnostics},
+    {"DataFlashReadModifyWrite", SetupUnsealed, RunDataFlashReadModifyWrite},
+    {"DataFlashBatch3Params", SetupUnsealed, RunDataFlashBatch},
+    {"DataFlashOutOfRange", SetupUnsealed, RunDataFlashOutOfRange},
+    {"SetThresholds", NULL, RunSetThresholds},
+    {"InterruptServiceIdle", NULL, RunInterruptServiceIdle},
+    {"InterruptServicePending", SetupVoltageHigh, RunInterruptServicePending},
+    {"GetVoltageRetried", SetupOneNack, RunGetVoltage},
+    {"GetChemIdRetriedResponse", SetupNackedResponse, RunGetChemId},
+    {"GetChemIdCorruptedResponse", SetupCorruptedResponse, RunGetChemId},
+    {"GetVoltageFailing", SetupDeadBus, RunGetVoltageFailing},
+    {"EnableImpedanceTracking", SetupImpedanceDisabled, RunEnableImpedanceTracking},
+    {"DisableImpedanceTracking", SetupUnsealed, RunDisableImpedanceTracking},
+    {"EnableLifetimeTracking", SetupUnsealed, RunEnableLifetimeTracking},
+    {"DisableLifetimeTracking", SetupUnsealed, RunDisableLifetimeTracking},
+    {"Reset", SetupUnsealed, RunReset},
+    {"Unseal", NULL, RunUnseal},
+    {"FullAccess", SetupUnsealed, RunFullAccess},
+    {"Seal", SetupFullAccess, RunSeal},
+    {"ResetLifetimeHistory", SetupUnsealed, RunResetLifetimeHistory},
+    {"ExitRomMode", SetupRomMode, RunExitRomMode},
+    {"Session3Reads", NULL, RunSession},
+    {"CachedReads", NULL, RunCachedReads},
+    {"SchedulerIdleMinute", NULL, RunSchedulerMinute},
+    {"SchedulerLoadedMinute", SetupHeavyLoad, RunSchedulerMinute},
+    {"LinuxI2cGetVoltage", SetupLinuxI2c, RunLinuxI2cGetVoltage},
+    {"LinuxI2cGetChemId", SetupLinuxI2c, RunLinuxI2cGetChemId},
+    {"LinuxI2cReadDiagnostics", SetupLinuxI2c, RunLinuxI2cReadDiagnostics},
+    {"LinuxI2cRackVoltages", SetupLinuxI2cRack, RunLinuxI2cRackVoltages},
+    {"AsyncPrimedRead", NULL, RunAsyncPrimedRead},
+    {"AsyncPrimedReadOpenFailure", SetupOpenFailure, RunAsyncPrimedRead},
+    {"ExecuteGoldenImage", NULL, RunExecuteGoldenImage},
+    {"ExecuteGoldenImageStream", NULL, RunExecuteGoldenImageStream},
+    {"ExecuteGoldenImageIncremental", SetupUnprogrammed, RunExecuteGoldenImageIncremental},
+    {"ExecuteGoldenImageIncrementalUnchanged", SetupProgrammed, RunExecuteGoldenImageIncrementalUnchanged},
+    {"ExecuteGoldenImageIncrementalOneRow", SetupOneRowChanged, RunExecuteGoldenImageIncremental},
+    {"ExecuteGoldenImageBinary", NULL, RunExecuteGoldenImageBinary},
+};
+
+
+static void RunCase(const BenchCase *benchCase, TwiSpeed speed, BenchResult *result)
+{
+    static const FuelGaugeClock clock = {
+        .getTimeUs = FuelGaugeSimGetTimeUs,
+        .delayUs = FuelGaugeSimDelayUs,
+    };
+
+    FuelGaugeSimInit(&sim);
+    // the simulator does not compute the data flash checksum; report the one the image expects
+    sim.romRegs[0x14] = 0xCF;
+    sim.romRegs[0x15] = 0x1A;
+
+    FuelGaugeSimAttach(&sim);
+    FuelGaugeInitTwi(FuelGaugeSimGetTwi());
+    FuelGaugeInitClock(&clock);
+
+    asyncPending = false;
+
+    if (benchCase->setup != NULL)
+        benchCase->setup();
+
+    // start from an idle driver, without a bus hold left over by the setup
+    FuelGaugeInitTwi(FuelGaugeSimGetTwi());
+    FuelGaugeInitClock(&clock);
+    FuelGaugeGetDefaultDevice()->speed = speed;
+
+    FuelGaugeSimStats before = sim.stats;
+    uint64_t startNs = sim.timeNs;
+
+    result->ok = benchCase->run();
+
+    snprintf(result->name, sizeof(result->name), "%s", benchCase->name);
+    result->khz = (speed == TWI_400KHZ) ? 400 : 100;
+    result->transactions = sim.stats.transactions - before.transactions;
+    result->bytes = sim.stats.bytes - before.bytes;
+    result->opens = sim.stats.opens - before.opens;
+    result->closes = sim.stats.closes - before.closes;
+    result->timeUs = (uint32_t) ((sim.timeNs - startNs) / 1000);
+}
+
+static void PrintResult(const BenchResult *result, bool last)
+{
+    printf("  {\"name\": \"%s\", \"khz\": %u, \"transactions\": %u, \"bytes\": %u, "
+           "\"opens\": %u, \"closes\": %u, \"timeUs\": %u, \"ok\": %s}%s\n",
+           result->name, result->khz, result->transactions, result->bytes,
+           result->opens, result->closes, result->timeUs,
+           (result->ok == true) ? "true" : "false", (last == true) ? "" : ",");
+}
+
+static bool ParseResult(const char *line, BenchResult *result)
+{
+    char ok[8];
+
+    int count = sscanf(line, " {\"name\": \"%39[^\"]\", \"khz\": %u, \"transactions\": %u, \"bytes\": %u, "
+                       "\"opens\": %u, \"closes\": %u, \"timeUs\": %u, \"ok\": %7[a-z]",
+                       result->name, &result->khz, &result->transactions, &result->bytes,
+                       &result->opens, &result->closes, &result->timeUs, ok);
+
+    result->ok = (strcmp(ok, "true") == 0);
+
+    return (count == 8);
+}
+
+// A case regresses when it fails or costs more on any axis than in the baseline
+static int CheckBaseline(const char *path, const BenchResult *results, uint32_t count)
+{
+    FILE *file = fopen(path, "r");
+    char line[256];
+    int regressions = 0;
+
+    if (file == NULL) {
+        fprintf(stderr, "bench: cannot open baseline %s\n", path);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        BenchResult base;
+
+        if (ParseResult(line, &base) == false)
+            continue;
+
+        for (uint32_t i = 0; i < count; i++) {
+            const BenchResult *now = &results[i];
+
+            if (strcmp(now->name, base.name) != 0 || now->khz != base.khz)
+                continue;
+
+            if ((base.ok == true && now->ok == false)
+                || now->transactions > base.transactions
+                || now->bytes > base.bytes
+                || now->opens > base.opens
+                || now->timeUs > base.timeUs) {
+                fprintf(stderr, "bench: %s @ %u kHz regressed: transactions %u -> %u, bytes %u -> %u, "
+                        "opens %u -> %u, time %u -> %u us%s\n",
+                        now->name, now->khz, base.transactions, now->transactions, base.bytes, now->bytes,
+                        base.opens, now->opens, base.timeUs, now->timeUs,
+                        (now->ok == false) ? ", failed" : "");
+                regressions++;
+            }
+        }
+    }
+
+    fclose(file);
+
+    return regressions;
+}
+
+
+int main(int argc, char *argv[])
+{
+    static const TwiSpeed speeds [] = {TWI_100KHZ, TWI_400KHZ};
+    static BenchResult results[BENCH_MAX_RESULTS];
+    const char *baseline = NULL;
+    uint32_t count = 0;
+    int failures = 0;
+
+    if (argc == 3 && strcmp(argv[1], "--baseline") == 0) {
+        baseline = argv[2];
+    } else if (argc != 1) {
+        fprintf(stderr, "usage: %s [--baseline file.json]\n", argv[0]);
+        return 2;
+    }
+
+    for (uint32_t s = 0; s < sizeof(speeds) / sizeof(speeds[0]); s++) {
+        for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+            RunCase(&cases[c], speeds[s], &results[count]);
+
+            if (results[count].ok == false) {
+                fprintf(stderr, "bench: %s @ %u kHz failed\n", results[count].name, results[count].khz);
+                failures++;
+            }
+
+            count++;
+        }
+    }
+
+    printf("{\"results\": [\n");
+    for (uint32_t i = 0; i < count; i++)
+        PrintResult(&results[i], i == count - 1);
+    printf("]}\n");
+
+    if (baseline != NULL)
+        failures += CheckBaseline(baseline, results, count);
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+#include "FuelGaugeFleet.h"
+
+#include <assert.h>
+#include <pthread.h>
+
+
+typedef struct {
+    const FuelGaugeFleetBus *bus;
+    FuelGaugePublisher *table;          // entries of this bus
+    uint32_t (*getTimeMs)(void);
+    uint32_t failures;
+} FleetWorker;
+
+
+/**
+ *  Local function prototypes
+ */
+static void *RunWorker(void *context);
+static bool PollDevice(FleetWorker *worker, FuelGaugeDevice *device, FuelGaugePublisher *publisher);
+
+
+void FuelGaugeFleetInit(FuelGaugeFleet *fleet,
+                        const FuelGaugeFleetBus *buses,
+                        uint8_t busCount,
+                        FuelGaugePublisher *table,
+                        uint16_t tableSize,
+                        uint32_t (*getTimeMs)(void))
+{
+    uint16_t deviceCount = 0;
+
+    assert(busCount <= FUEL_GAUGE_FLEET_MAX_BUSES);
+
+    for (uint8_t index = 0; index < busCount; index++)
+        deviceCount += buses[index].count;
+
+    assert(deviceCount <= tableSize);
+
+    fleet->buses = buses;
+    fleet->busCount = busCount;
+    fleet->getTimeMs = getTimeMs;
+    fleet->table = table;
+    fleet->deviceCount = deviceCount;
+    fleet->sweeps = 0;
+    fleet->failures = 0;
+
+    for (uint16_t index = 0; index < deviceCount; index++)
+        FuelGaugePublisherInit(&table[index]);
+}
+
+bool FuelGaugeFleetSweep(FuelGaugeFleet *fleet)
+{
+    FleetWorker workers[FUEL_GAUGE_FLEET_MAX_BUSES];
+    pthread_t threads[FUEL_GAUGE_FLEET_MAX_BUSES];
+    bool started[FUEL_GAUGE_FLEET_MAX_BUSES];
+    FuelGaugePublisher *table = fleet->table;
+    uint32_t failures = 0;
+
+    for (uint8_t index = 0; index < fleet->busCount; index++) {
+        workers[index].bus = &fleet->buses[index];
+        workers[index].table = table;
+        workers[index].getTimeMs = fleet->getTimeMs;
+        workers[index].failures = 0;
+        table += fleet->buses[index].count;
+
+        started[index] = (pthread_create(&threads[index], NULL, RunWorker, &workers[index]) == 0);
+
+        // polling from here would leave the bus selection of this thread changed
+        if (started[index] == false)
+            workers[index].failures = fleet->buses[index].count;
+    }
+
+    for (uint8_t index = 0; index < fleet->busCount; index++) {
+        if (started[index] == true)
+            pthread_join(threads[index], NULL);
+
+        failures += workers[index].failures;
+    }
+
+    fleet->sweeps++;
+    fleet->failures += failures;
+
+    return (failures == 0);
+}
+
+bool FuelGaugeFleetRead(FuelGaugeFleet *fleet,
+                        uint16_t index,
+                        FuelGaugePublication *publication)
+{
+    assert(index < fleet->deviceCount);
+
+    return FuelGaugePublisherRead(&fleet->table[index], publication);
+}
+
+/***********************************************************************
+   Static functions.
+***********************************************************************/
+// One bus: its devices one after the other, each in its own bus session
+static void *RunWorker(void *context)
+{
+    FleetWorker *worker = (FleetWorker *) context;
+    const FuelGaugeFleetBus *bus = worker->bus;
+
+    if (bus->select != NULL)
+        bus->select(bus->context);
+
+    for (uint16_t index = 0; index < bus->count; index++) {
+        const FuelGaugeFleetDevice *device = &bus->devices[index];
+
+        if (device->select != NULL)
+            device->select(device->context);
+
+        if (PollDevice(worker, device->device, &worker->table[index]) == false)
+            worker->failures++;
+    }
+
+    return NULL;
+}
+
+static bool PollDevice(FleetWorker *worker, FuelGaugeDevice *device, FuelGaugePublisher *publisher)
+{
+    static const FuelGaugeMac macs [] = {
+        FUEL_GAUGE_MAC_OPERATION_STATUS,
+        FUEL_GAUGE_MAC_GAUGING_STATUS,
+        FUEL_GAUGE_MAC_CHARGING_STATUS,
+        FUEL_GAUGE_MAC_MANUFACTURING_STATUS,
+    };
+    FuelGaugePublication publication = {0};
+    void *const values [] = {
+        &publication.operationStatus,
+        &publication.gaugingStatus,
+        &publication.chargingStatus,
+        &publication.manufacturingStatus,
+    };
+
+    if (FuelGaugeDevBeginSession(device) == false)
+        return false;
+
+    bool result = FuelGaugeDevReadSnapshot(device, &publication.snapshot);
+    result &= FuelGaugeDevReadMacs(device, macs, values, sizeof(macs) / sizeof(macs[0]));
+
+    FuelGaugeDevEndSession(device);
+
+    if (result == false)
+        return false;
+
+    if (worker->getTimeMs != NULL)
+        publication.timeMs = worker->getTimeMs();
+
+    FuelGaugePublisherPublish(publisher, &publication);
+
+    return true;
+}
@@ -0,0 +1,79 @@
+#ifndef HOST_FUEL_GAUGE_FLEET_H_
+#define HOST_FUEL_GAUGE_FLEET_H_
+
+/*
+ * Note:    Polls many gauges spread over several buses, one worker thread per
+ *          bus. A worker polls the devices of its bus back to back, so a sweep
+ *          takes as long as the busiest bus rather than the sum of all of
+ *          them. Results go to a table of FuelGaugePublisher, one per device,
+ *          readable from any thread while the next sweep runs.
+*/
+#include "FuelGauge.h"
+#include "FuelGaugePublisher.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+#ifndef FUEL_GAUGE_FLEET_MAX_BUSES
+#define FUEL_GAUGE_FLEET_MAX_BUSES          16
+#endif
+
+
+typedef struct {
+    FuelGaugeDevice *device;
+    void (*select)(void *context);      // optional, called before the device is polled (mux channel, ...)
+    void *context;
+} FuelGaugeFleetDevice;
+
+typedef struct {
+    FuelGaugeFleetDevice *devices;
+    uint16_t count;
+    void (*select)(void *context);      // optional, called first in the bus worker, e.g. FuelGaugeLinuxI2cSelect()
+    void *context;
+} FuelGaugeFleetBus;
+
+typedef struct {
+    const FuelGaugeFleetBus *buses;
+    uint8_t busCount;
+    uint32_t (*getTimeMs)(void);        // optional, stamps each publication
+    FuelGaugePublisher *table;          // one entry per device, in bus order
+    uint16_t deviceCount;
+    uint32_t sweeps;
+    uint32_t failures;                  // device polls that failed, over all sweeps
+} FuelGaugeFleet;
+
+
+/**
+* \brief Setup a fleet.
+*
+* \param table FuelGaugePublisher per device, numbered in the order of buses
+* then of their devices; tableSize must cover every device.
+* \param getTimeMs free-running millisecond clock for FuelGaugePublication
+* timeMs, may be NULL.
+*/
+void FuelGaugeFleetInit(FuelGaugeFleet *fleet,
+                        const FuelGaugeFleetBus *buses,
+                        uint8_t busCount,
+                        FuelGaugePublisher *table,
+                        uint16_t tableSize,
+                        uint32_t (*getTimeMs)(void));
+
+/**
+* \brief Polls every device once, the buses in parallel, and publishes the
+* snapshot and status words of each device to its table entry.
+*
+* \return false if any device could not be polled; its entry keeps its
+* previous publication. A bus whose worker thread cannot be started is not
+* polled at all, its devices count as failed.
+*/
+bool FuelGaugeFleetSweep(FuelGaugeFleet *fleet);
+
+/**
+* \brief Copies the latest publication of a device, from any thread.
+*/
+bool FuelGaugeFleetRead(FuelGaugeFleet *fleet,
+                        uint16_t index,
+                        FuelGaugePublication *publication);
+
+#endif  // HOST_FUEL_GAUGE_FLEET_H_
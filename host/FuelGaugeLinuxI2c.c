@@ -0,0 +1,139 @@
+#include "FuelGaugeLinuxI2c.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/i2c-dev.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+
+/**
+ *  Local data
+ */
+static _Thread_local FuelGaugeLinuxI2c *selected = NULL;
+
+static bool LinuxOpen(TwiSpeed speed);
+static bool LinuxRead(uint8_t address, const uint8_t *reg, uint8_t regSize, void *data, uint8_t size);
+static bool LinuxWrite(uint8_t address, const uint8_t *reg, uint8_t regSize, const uint8_t *data, uint8_t size);
+static void LinuxClose(void);
+
+static TwiInterface linuxTwi = {
+    .open = LinuxOpen,
+    .read = LinuxRead,
+    .write = LinuxWrite,
+    .close = LinuxClose,
+};
+
+/**
+ *  Local function prototypes
+ */
+static int SystemIoctl(int fd, unsigned long request, void *arg);
+
+
+bool FuelGaugeLinuxI2cOpen(FuelGaugeLinuxI2c *bus, const char *path)
+{
+    int fd = open(path, O_RDWR | O_CLOEXEC);
+
+    FuelGaugeLinuxI2cInit(bus, fd, SystemIoctl);
+
+    return (fd >= 0);
+}
+
+void FuelGaugeLinuxI2cInit(FuelGaugeLinuxI2c *bus, int fd, FuelGaugeLinuxIoctl ioctl)
+{
+    memset(bus, 0, sizeof(*bus));
+
+    bus->fd = fd;
+    bus->ioctl = ioctl;
+}
+
+void FuelGaugeLinuxI2cClose(FuelGaugeLinuxI2c *bus)
+{
+    if (bus->fd >= 0)
+        close(bus->fd);
+
+    bus->fd = -1;
+}
+
+void FuelGaugeLinuxI2cSelect(FuelGaugeLinuxI2c *bus)
+{
+    selected = bus;
+}
+
+TwiInterface *FuelGaugeLinuxI2cGetTwi(void)
+{
+    return &linuxTwi;
+}
+
+bool FuelGaugeLinuxI2cTransfer(FuelGaugeLinuxI2c *bus, struct i2c_msg *messages, uint32_t count)
+{
+    while (count > 0) {
+        struct i2c_rdwr_ioctl_data transfer = {
+            .msgs = messages,
+            .nmsgs = (count < I2C_RDWR_IOCTL_MAX_MSGS) ? count : I2C_RDWR_IOCTL_MAX_MSGS,
+        };
+        int result;
+
+        // a read stays in the ioctl of the register write before it
+        if (transfer.nmsgs < count
+            && (messages[transfer.nmsgs].flags & I2C_M_RD) != 0
+            && (messages[transfer.nmsgs - 1].flags & I2C_M_RD) == 0)
+            transfer.nmsgs--;
+
+        do {
+            bus->syscalls++;
+            result = bus->ioctl(bus->fd, I2C_RDWR, &transfer);
+        } while (result < 0 && errno == EINTR);
+
+        // a NACK fails the whole ioctl
+        if (result < 0)
+            return false;
+
+        messages += transfer.nmsgs;
+        count -= transfer.nmsgs;
+    }
+
+    return true;
+}
+
+/***********************************************************************
+   Static functions.
+***********************************************************************/
+static bool LinuxOpen(TwiSpeed speed)
+{
+    (void) speed;
+
+    return (selected != NULL && selected->fd >= 0);
+}
+
+static bool LinuxRead(uint8_t address, const uint8_t *reg, uint8_t regSize, void *data, uint8_t size)
+{
+    // the register pointer write, then the read after a repeated start
+    struct i2c_msg messages [] = {
+        {.addr = address, .flags = 0, .len = regSize, .buf = (uint8_t *) reg},
+        {.addr = address, .flags = I2C_M_RD, .len = size, .buf = data},
+    };
+
+    return FuelGaugeLinuxI2cTransfer(selected, messages, 2);
+}
+
+static bool LinuxWrite(uint8_t address, const uint8_t *reg, uint8_t regSize, const uint8_t *data, uint8_t size)
+{
+    uint8_t buffer[UINT8_MAX + UINT8_MAX];
+    struct i2c_msg message = {.addr = address, .flags = 0, .len = regSize + size, .buf = buffer};
+
+    memcpy(buffer, reg, regSize);
+    memcpy(&buffer[regSize], data, size);
+
+    return FuelGaugeLinuxI2cTransfer(selected, &message, 1);
+}
+
+static void LinuxClose(void)
+{
+}
+
+static int SystemIoctl(int fd, unsigned long request, void *arg)
+{
+    return ioctl(fd, request, arg);
+}
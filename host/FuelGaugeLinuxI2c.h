@@ -0,0 +1,72 @@
+#ifndef HOST_FUEL_GAUGE_LINUX_I2C_H_
+#define HOST_FUEL_GAUGE_LINUX_I2C_H_
+
+/*
+ * Note:    TwiInterface over Linux i2c-dev. A register read is one I2C_RDWR
+ *          ioctl carrying the register write and the read with a repeated
+ *          start, instead of a write() and a read() syscall; a write is one
+ *          I2C_RDWR ioctl as well.
+ *
+ *          TwiInterface functions carry no context, so each thread selects
+ *          the bus its FuelGauge calls go to with FuelGaugeLinuxI2cSelect(),
+ *          e.g. one poller thread per bus. The bus speed is set by the kernel
+ *          (device tree), TwiInterface open and close only check the bus.
+ *
+ *          ioctl is a hook so the backend runs against the simulated gauge
+ *          through a shim translating the messages (see FuelGaugeBench.c).
+*/
+#include "TwiInterface.h"
+
+#include <linux/i2c.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+
+typedef int (*FuelGaugeLinuxIoctl)(int fd, unsigned long request, void *arg);
+
+typedef struct {
+    int fd;
+    FuelGaugeLinuxIoctl ioctl;
+    uint32_t syscalls;                  // ioctls issued, retries after EINTR included
+} FuelGaugeLinuxI2c;
+
+
+/**
+* \brief Opens an i2c-dev adapter, e.g. "/dev/i2c-1".
+*
+* \return false if it could not be opened.
+*/
+bool FuelGaugeLinuxI2cOpen(FuelGaugeLinuxI2c *bus, const char *path);
+
+/**
+* \brief Setup a bus on an already open descriptor, with an ioctl shim.
+*/
+void FuelGaugeLinuxI2cInit(FuelGaugeLinuxI2c *bus, int fd, FuelGaugeLinuxIoctl ioctl);
+
+/**
+* \brief Closes the adapter opened by FuelGaugeLinuxI2cOpen().
+*/
+void FuelGaugeLinuxI2cClose(FuelGaugeLinuxI2c *bus);
+
+/**
+* \brief Selects the bus used by FuelGaugeLinuxI2cGetTwi() in the calling thread.
+*/
+void FuelGaugeLinuxI2cSelect(FuelGaugeLinuxI2c *bus);
+
+/**
+* \brief Gets a TwiInterface talking to the bus selected in the calling thread.
+*/
+TwiInterface *FuelGaugeLinuxI2cGetTwi(void);
+
+/**
+* \brief Runs messages as combined transfers, up to I2C_RDWR_IOCTL_MAX_MSGS
+* per ioctl, each ending with one stop. A register write and the read after
+* it are never split over two ioctls. For independent transfers only, e.g.
+* standard register reads of gauges at different addresses: the gauge needs
+* bus free time between MAC command and response.
+*
+* \return false if any ioctl failed.
+*/
+bool FuelGaugeLinuxI2cTransfer(FuelGaugeLinuxI2c *bus, struct i2c_msg *messages, uint32_t count);
+
+#endif  // HOST_FUEL_GAUGE_LINUX_I2C_H_
@@ -0,0 +1,685 @@
+#include "FuelGaugeSim.h"
+
+#include <string.h>
+
+
+/**
+ *  Defines
+ */
+#define SIM_REG_CONTROL                     0x00
+#define SIM_REG_AT_RATE                     0x02
+#define SIM_REG_TEMPERATURE                 0x06
+#define SIM_REG_VOLTAGE                     0x08
+#define SIM_REG_CURRENT                     0x0C
+#define SIM_REG_ALT_MNFG_ACCESS             0x3E
+#define SIM_REG_MAC_DATA                    0x40
+#define SIM_REG_MAC_DATA_SUM                0x60
+#define SIM_REG_MAC_DATA_LEN                0x61
+#define SIM_REG_THRESHOLDS_START            0x62
+#define SIM_REG_VOLT_HI_SET                 0x62
+#define SIM_REG_VOLT_HI_CLEAR               0x64
+#define SIM_REG_VOLT_LO_SET                 0x66
+#define SIM_REG_VOLT_LO_CLEAR               0x68
+#define SIM_REG_TEMP_HI_SET                 0x6A
+#define SIM_REG_TEMP_HI_CLEAR               0x6B
+#define SIM_REG_TEMP_LO_SET                 0x6C
+#define SIM_REG_TEMP_LO_CLEAR               0x6D
+#define SIM_REG_INTERRUPT_STATUS            0x6E
+#define SIM_REG_THRESHOLDS_END              0x6F
+
+#define SIM_ROM_REG_EXIT                    0x08
+#define SIM_ROM_REG_DF_WRITE                0x0F
+#define SIM_ROM_EXIT_VALUE                  0x11
+#define SIM_ROM_EXIT_MAC_VALUE              0x08
+#define SIM_ROM_REG_ERASE                   0x11
+#define SIM_ROM_ERASE_KEY                   0x83DE
+
+#define SIM_CMD_FIRMWARE_VERSION            0x0002
+#define SIM_CMD_CHEM_ID                     0x0006
+#define SIM_CMD_IT_TOGGLE                   0x0021
+#define SIM_CMD_LIFETIME_TOGGLE             0x0023
+#define SIM_CMD_RESET_LIFETIME              0x0028
+#define SIM_CMD_SEAL                        0x0030
+#define SIM_CMD_SECURITY_KEYS               0x0035
+#define SIM_CMD_RESET                       0x0041
+#define SIM_CMD_OPERATION_STATUS            0x0054
+#define SIM_CMD_CHARGING_STATUS             0x0055
+#define SIM_CMD_GAUGING_STATUS              0x0056
+#define SIM_CMD_MANUFACTURING_STATUS        0x0057
+#define SIM_CMD_LIFETIME_DATA               0x0060
+#define SIM_CMD_DA_STATUS1                  0x0071
+#define SIM_CMD_DA_STATUS2                  0x0072
+#define SIM_CMD_IT_STATUS1                  0x0073
+#define SIM_CMD_IT_STATUS2                  0x0074
+#define SIM_CMD_IT_STATUS3                  0x0075
+#define SIM_CMD_ROM_MODE                    0x0F00
+
+#define SIM_INT_VOLT_HI                     (1 << 0)
+#define SIM_INT_VOLT_LO                     (1 << 1)
+#define SIM_INT_TEMP_HI                     (1 << 2)
+#define SIM_INT_TEMP_LO                     (1 << 3)
+#define SIM_INT_ALL                         0x0F
+
+#define SIM_IT_ENABLED_BIT                  3
+#define SIM_LF_ENABLED_BIT                  5
+
+#define SIM_BIT_TIMES_PER_BYTE              9
+#define SIM_NS_PER_SECOND                   1000000000ULL
+
+
+/**
+ *  Local data
+ */
+static FuelGaugeSim *attached = NULL;
+static _Thread_local FuelGaugeSim *threadAttached = NULL;
+
+static bool SimOpen(TwiSpeed speed);
+static bool SimRead(uint8_t address, const uint8_t *reg, uint8_t regSize, void *data, uint8_t size);
+static bool SimWrite(uint8_t address, const uint8_t *reg, uint8_t regSize, const uint8_t *data, uint8_t size);
+static void SimClose(void);
+
+static TwiInterface simTwi = {
+    .open = SimOpen,
+    .read = SimRead,
+    .write = SimWrite,
+    .close = SimClose,
+};
+
+/**
+ *  Local function prototypes
+ */
+static void AccountTransaction(FuelGaugeSim *sim, uint16_t bytesOnWire);
+static bool IsNackInjected(FuelGaugeSim *sim);
+static bool WriteRom(FuelGaugeSim *sim, const uint8_t *data, uint16_t size);
+static bool WriteFirmware(FuelGaugeSim *sim, const uint8_t *data, uint16_t size);
+static bool HandleKey(FuelGaugeSim *sim, uint16_t word);
+static bool HandleMacCommand(FuelGaugeSim *sim, uint16_t command);
+static bool CommitDataFlashWrite(FuelGaugeSim *sim, uint8_t sum, uint8_t length);
+static void SetMacResponse(FuelGaugeSim *sim, uint16_t command, const uint8_t *data, uint8_t size);
+static bool IsDataFlashAddress(uint16_t address, uint16_t size);
+static bool MatchesKeyWord(const uint8_t *key, uint16_t word);
+static void PutLittleEndian(uint8_t *buffer, uint32_t value, uint8_t size);
+static void UpdateInterrupts(FuelGaugeSim *sim);
+static void CheckThreshold(FuelGaugeSim *sim, uint8_t flag, bool set, bool clear);
+static FuelGaugeSim *GetAttached(void);
+
+
+void FuelGaugeSimInit(FuelGaugeSim *sim)
+{
+    static const uint8_t unsealKey [] = {0x04, 0x14, 0x36, 0x72};
+    static const uint8_t fullAccessKey [] = {0xff, 0xff, 0xff, 0xff};
+    // device number 0x6115, firmware version 0x0102
+    static const uint8_t firmwareVersion [] = {0x15, 0x61, 0x02, 0x01, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+    memset(sim, 0, sizeof(*sim));
+
+    sim->address = 0x55;
+    sim->romAddress = 0x0B;
+    memcpy(sim->unsealKey, unsealKey, sizeof(unsealKey));
+    memcpy(sim->fullAccessKey, fullAccessKey, sizeof(fullAccessKey));
+    memcpy(sim->firmwareVersion, firmwareVersion, sizeof(firmwareVersion));
+
+    sim->timing.startStopNs = 20000;
+    sim->timing.openNs = 50000;
+    sim->timing.closeNs = 20000;
+
+    sim->security = FUEL_GAUGE_SIM_SEALED;
+    sim->speed = TWI_100KHZ;
+    sim->chemId = 0x3230;
+    sim->manufacturingStatus = (1 << SIM_IT_ENABLED_BIT);
+    sim->operationStatus = 0x00000105;
+    sim->chargingStatus = 0x00020000;
+    sim->gaugingStatus = 0x00000040;
+
+    memset(sim->dataFlash, 0xff, sizeof(sim->dataFlash));
+
+    // thresholds well outside the values below, so nothing fires until they are programmed
+    PutLittleEndian(&sim->regs[SIM_REG_VOLT_HI_SET], 5000, sizeof(uint16_t));
+    PutLittleEndian(&sim->regs[SIM_REG_VOLT_HI_CLEAR], 4900, sizeof(uint16_t));
+    PutLittleEndian(&sim->regs[SIM_REG_VOLT_LO_SET], 2500, sizeof(uint16_t));
+    PutLittleEndian(&sim->regs[SIM_REG_VOLT_LO_CLEAR], 2600, sizeof(uint16_t));
+    sim->regs[SIM_REG_TEMP_HI_SET] = 80;
+    sim->regs[SIM_REG_TEMP_HI_CLEAR] = 75;
+    sim->regs[SIM_REG_TEMP_LO_SET] = (uint8_t) -40;
+    sim->regs[SIM_REG_TEMP_LO_CLEAR] = (uint8_t) -35;
+
+
+    FuelGaugeSimSetRegister(sim, 0x06, 2982);               // Temperature, 0.1 K
+    FuelGaugeSimSetRegister(sim, 0x08, 3800);               // Voltage, mV
+    FuelGaugeSimSetRegister(sim, 0x0A, 0x00c0);             // BatteryStatus
+    FuelGaugeSimSetRegister(sim, 0x0C, (uint16_t) -250);    // Current, mA
+    FuelGaugeSimSetRegister(sim, 0x10, 2400);               // RemainingCapacity, mAh
+    FuelGaugeSimSetRegister(sim, 0x12, 3000);               // FullChargeCapacity, mAh
+    FuelGaugeSimSetRegister(sim, 0x14, (uint16_t) -240);    // AverageCurrent, mA
+    FuelGaugeSimSetRegister(sim, 0x16, 600);                // AverageTimeToEmpty, min
+    FuelGaugeSimSetRegister(sim, 0x18, 0xffff);             // AverageTimeToFull, min
+    FuelGaugeSimSetRegister(sim, 0x28, 2985);               // InternalTemperature, 0.1 K
+    FuelGaugeSimSetRegister(sim, 0x2A, 12);                 // CycleCount
+    FuelGaugeSimSetRegister(sim, 0x2C, 80);                 // RelativeStateOfCharge, %
+    FuelGaugeSimSetRegister(sim, 0x2E, 98);                 // StateOfHealth, %
+    FuelGaugeSimSetRegister(sim, 0x30, 4200);               // ChargingVoltage, mV
+    FuelGaugeSimSetRegister(sim, 0x32, 1500);               // ChargingCurrent, mA
+    FuelGaugeSimSetRegister(sim, 0x3C, 3000);               // DesignCapacity, mAh
+
+    // the registers were set one by one from 0, start with nothing latched
+    sim->regs[SIM_REG_INTERRUPT_STATUS] = 0;
+    sim->interruptPin = false;
+    sim->interruptArmed = SIM_INT_ALL;
+}
+
+void FuelGaugeSimAttach(FuelGaugeSim *sim)
+{
+    attached = sim;
+}
+
+void FuelGaugeSimAttachThread(FuelGaugeSim *sim)
+{
+    threadAttached = sim;
+}
+
+TwiInterface *FuelGaugeSimGetTwi(void)
+{
+    return &simTwi;
+}
+
+void FuelGaugeSimSetRegister(FuelGaugeSim *sim, uint8_t registerAddress, uint16_t value)
+{
+    PutLittleEndian(&sim->regs[registerAddress], value, sizeof(uint16_t));
+    UpdateInterrupts(sim);
+}
+
+uint16_t FuelGaugeSimGetRegister(const FuelGaugeSim *sim, uint8_t registerAddress)
+{
+    return ((sim->regs[registerAddress + 1] << 8) | sim->regs[registerAddress]);
+}
+
+bool FuelGaugeSimWrite(FuelGaugeSim *sim, uint8_t address, const uint8_t *data, uint16_t size)
+{
+    // an injected NACK ends the transfer after the address byte
+    if (IsNackInjected(sim) == true) {
+        AccountTransaction(sim, 1);
+        sim->stats.nacks++;
+        return false;
+    }
+
+    // address byte plus everything written
+    AccountTransaction(sim, size + 1);
+
+    bool result = false;
+
+    if (sim->busOpen == true && size > 0) {
+        if (sim->romMode == true && address == sim->romAddress)
+            result = WriteRom(sim, data, size);
+        else if (sim->romMode == false && address == sim->address)
+            result = WriteFirmware(sim, data, size);
+    }
+
+    if (result == false)
+        sim->stats.nacks++;
+
+    return result;
+}
+
+bool FuelGaugeSimRead(FuelGaugeSim *sim, uint8_t address, uint8_t registerAddress, uint8_t *data, uint16_t size)
+{
+    if (IsNackInjected(sim) == true) {
+        AccountTransaction(sim, 1);
+        sim->stats.nacks++;
+        return false;
+    }
+
+    // address and register, then address again after the repeated start
+    AccountTransaction(sim, size + 3);
+
+    const uint8_t *source;
+    uint16_t available;
+
+    if (sim->busOpen == true && sim->romMode == true && address == sim->romAddress) {
+        source = sim->romRegs;
+        available = sizeof(sim->romRegs);
+    } else if (sim->busOpen == true && sim->romMode == false && address == sim->address) {
+        source = sim->regs;
+        available = sizeof(sim->regs);
+    } else {
+        sim->stats.nacks++;
+        return false;
+    }
+
+    // the register pointer auto-increments; past the end the gauge returns 0xFF
+    for (uint16_t i = 0; i < size; i++)
+        data[i] = (registerAddress + i < available) ? source[registerAddress + i] : 0xff;
+
+    // reading InterruptStatus clears it and releases GPOUT
+    if (source == sim->regs && registerAddress <= SIM_REG_INTERRUPT_STATUS
+        && registerAddress + size > SIM_REG_INTERRUPT_STATUS) {
+        sim->regs[SIM_REG_INTERRUPT_STATUS] = 0;
+        sim->interruptPin = false;
+    }
+
+    if (sim->corruptCount > 0 && size > 0) {
+        sim->corruptCount--;
+        data[0] ^= 0x01;
+    }
+
+    return true;
+}
+
+uint32_t FuelGaugeSimGetTimeUs(void)
+{
+    return (uint32_t) (GetAttached()->timeNs / 1000);
+}
+
+uint32_t FuelGaugeSimGetTimeMs(void)
+{
+    return (uint32_t) (GetAttached()->timeNs / 1000000);
+}
+
+void FuelGaugeSimDelayUs(uint32_t us)
+{
+    GetAttached()->timeNs += (uint64_t) us * 1000;
+}
+
+/***********************************************************************
+   Static functions.
+***********************************************************************/
+// The gauge attached to the calling thread, else the one attached for all threads
+static FuelGaugeSim *GetAttached(void)
+{
+    return (threadAttached != NULL) ? threadAttached : attached;
+}
+
+static bool SimOpen(TwiSpeed speed)
+{
+    FuelGaugeSim *sim = GetAttached();
+
+    if (sim->openFailCount > 0) {
+        sim->openFailCount--;
+        return false;
+    }
+
+    sim->busOpen = true;
+    sim->speed = speed;
+    sim->timeNs += sim->timing.openNs;
+    sim->stats.opens++;
+
+    return true;
+}
+
+static bool SimRead(uint8_t address, const uint8_t *reg, uint8_t regSize, void *data, uint8_t size)
+{
+    if (regSize != sizeof(uint8_t))
+        return false;
+
+    return FuelGaugeSimRead(GetAttached(), address, reg[0], data, size);
+}
+
+static bool SimWrite(uint8_t address, const uint8_t *reg, uint8_t regSize, const uint8_t *data, uint8_t size)
+{
+    uint8_t buffer[1 + UINT8_MAX];
+
+    if (regSize != sizeof(uint8_t))
+        return false;
+
+    buffer[0] = reg[0];
+    memcpy(&buffer[1], data, size);
+
+    return FuelGaugeSimWrite(GetAttached(), address, buffer, size + 1);
+}
+
+static void SimClose(void)
+{
+    FuelGaugeSim *sim = GetAttached();
+
+    sim->busOpen = false;
+    sim->timeNs += sim->timing.closeNs;
+    sim->stats.closes++;
+}
+
+static void AccountTransaction(FuelGaugeSim *sim, uint16_t bytesOnWire)
+{
+    uint64_t byteNs = sim->timing.byteNs;
+
+    if (byteNs == 0) {
+        uint32_t bitRate = (sim->speed == TWI_400KHZ) ? 400000 : 100000;
+        byteNs = (SIM_BIT_TIMES_PER_BYTE * SIM_NS_PER_SECOND) / bitRate;
+    }
+
+    if (sim->anyTransaction == true && sim->timeNs - sim->lastStopNs < FUEL_GAUGE_SIM_BUS_FREE_NS)
+        sim->stats.busFreeViolations++;
+
+    sim->timeNs += sim->timing.startStopNs + (bytesOnWire * byteNs);
+    sim->lastStopNs = sim->timeNs;
+    sim->anyTransaction = true;
+
+    sim->stats.transactions++;
+    sim->stats.bytes += bytesOnWire;
+}
+
+static bool IsNackInjected(FuelGaugeSim *sim)
+{
+    if (sim->nackCount == 0)
+        return false;
+
+    if (sim->nackSkip > 0) {
+        sim->nackSkip--;
+        return false;
+    }
+
+    sim->nackCount--;
+
+    return true;
+}
+
+static bool WriteRom(FuelGaugeSim *sim, const uint8_t *data, uint16_t size)
+{
+    uint8_t reg = data[0];
+
+    // count, address (little-endian), count - 2 data bytes
+    if (reg == SIM_ROM_REG_DF_WRITE) {
+        if (size < 4 || data[1] != size - 2)
+            return false;
+
+        uint16_t address = ((data[3] << 8) | data[2]);
+        uint16_t length = data[1] - 2;
+
+        if (IsDataFlashAddress(address, length) == false)
+            return false;
+
+        memcpy(&sim->dataFlash[address - FUEL_GAUGE_SIM_DF_START], &data[4], length);
+        return true;
+    }
+
+    // return to firmware, as sent by df.fs images and by FuelGaugeExitRomMode
+    if ((reg == SIM_ROM_REG_EXIT && size == 2 && data[1] == SIM_ROM_EXIT_VALUE)
+        || (reg == SIM_REG_ALT_MNFG_ACCESS && size == 2 && data[1] == SIM_ROM_EXIT_MAC_VALUE)) {
+        sim->romMode = false;
+        sim->security = FUEL_GAUGE_SIM_SEALED;
+        sim->keyStage = 0;
+        return true;
+    }
+
+    // data flash erase, df.fs images send it before writing the rows
+    if (reg == SIM_ROM_REG_ERASE && size == 3 && ((data[2] << 8) | data[1]) == SIM_ROM_ERASE_KEY) {
+        memset(sim->dataFlash, 0xff, sizeof(sim->dataFlash));
+        return true;
+    }
+
+    // other ROM commands (checksum requests) are latched but not modeled
+    for (uint16_t i = 1; i < size && reg + i - 1u < sizeof(sim->romRegs); i++)
+        sim->romRegs[reg + i - 1] = data[i];
+
+    return true;
+}
+
+static bool WriteFirmware(FuelGaugeSim *sim, const uint8_t *data, uint16_t size)
+{
+    uint8_t reg = data[0];
+
+    if ((reg == SIM_REG_CONTROL || reg == SIM_REG_ALT_MNFG_ACCESS) && size >= 3) {
+        uint16_t word = ((data[2] << 8) | data[1]);
+
+        // address followed by data: block write, executed by writing MacDataSum/Len
+        if (size > 3) {
+            if (sim->security == FUEL_GAUGE_SIM_SEALED
+                || size - 1u > sizeof(sim->pendingWrite)
+                || IsDataFlashAddress(word, size - 3) == false)
+                return false;
+
+            memcpy(sim->pendingWrite, &data[1], size - 1);
+            sim->pendingWriteSize = size - 1;
+            return true;
+        }
+
+        if (HandleKey(sim, word) == true)
+            return true;
+
+        return HandleMacCommand(sim, word);
+    }
+
+    if (reg == SIM_REG_MAC_DATA_SUM && size == 3)
+        return CommitDataFlashWrite(sim, data[1], data[2]);
+
+    if ((reg >= SIM_REG_THRESHOLDS_START && reg + size - 1 <= SIM_REG_THRESHOLDS_END + 1)
+        || (reg == SIM_REG_AT_RATE && size == 3)) {
+        memcpy(&sim->regs[reg], &data[1], size - 1);
+        UpdateInterrupts(sim);
+        return true;
+    }
+
+    // read-only registers ignore writes
+    return true;
+}
+
+// The gauge compares 16-bit words; either byte order of the configured key is accepted
+static bool HandleKey(FuelGaugeSim *sim, uint16_t word)
+{
+    const uint8_t *key = NULL;
+
+    if (sim->security == FUEL_GAUGE_SIM_SEALED)
+        key = sim->unsealKey;
+    else if (sim->security == FUEL_GAUGE_SIM_UNSEALED)
+        key = sim->fullAccessKey;
+    else
+        return false;
+
+    if (MatchesKeyWord(&key[sim->keyStage * 2], word) == false) {
+        sim->keyStage = MatchesKeyWord(key, word) ? 1 : 0;
+        return (sim->keyStage == 1);
+    }
+
+    if (++sim->keyStage == 2) {
+        sim->security = (sim->security == FUEL_GAUGE_SIM_SEALED) ? FUEL_GAUGE_SIM_UNSEALED
+                                                                 : FUEL_GAUGE_SIM_FULL_ACCESS;
+        sim->keyStage = 0;
+    }
+
+    return true;
+}
+
+static bool HandleMacCommand(FuelGaugeSim *sim, uint16_t command)
+{
+    uint8_t response[FUEL_GAUGE_SIM_MAC_DATA_SIZE];
+    uint8_t size = 0;
+
+    memset(response, 0, sizeof(response));
+
+    if (IsDataFlashAddress(command, FUEL_GAUGE_SIM_MAC_DATA_SIZE) == true) {
+        if (sim->security == FUEL_GAUGE_SIM_SEALED)
+            return false;
+
+        memcpy(response, &sim->dataFlash[command - FUEL_GAUGE_SIM_DF_START], FUEL_GAUGE_SIM_MAC_DATA_SIZE);
+        SetMacResponse(sim, command, response, FUEL_GAUGE_SIM_MAC_DATA_SIZE);
+        return true;
+    }
+
+    switch (command) {
+        case SIM_CMD_FIRMWARE_VERSION:
+            size = sizeof(sim->firmwareVersion);
+            memcpy(response, sim->firmwareVersion, size);
+            break;
+
+        case SIM_CMD_CHEM_ID:
+            size = sizeof(uint16_t);
+            PutLittleEndian(response, sim->chemId, size);
+            break;
+
+        case SIM_CMD_OPERATION_STATUS:
+            size = sizeof(uint32_t);
+            PutLittleEndian(response, sim->operationStatus, size);
+            break;
+
+        case SIM_CMD_CHARGING_STATUS:
+            size = 3;
+            PutLittleEndian(response, sim->chargingStatus, size);
+            break;
+
+        case SIM_CMD_GAUGING_STATUS:
+            size = sizeof(uint32_t);
+            PutLittleEndian(response, sim->gaugingStatus, size);
+            break;
+
+        case SIM_CMD_MANUFACTURING_STATUS:
+            size = sizeof(uint16_t);
+            PutLittleEndian(response, sim->manufacturingStatus, size);
+            break;
+
+        case SIM_CMD_DA_STATUS1:
+            // cell voltage 1, BAT and PACK voltage follow Voltage, cell current 1 follows Current
+            size = 32;
+            PutLittleEndian(&response[0], FuelGaugeSimGetRegister(sim, SIM_REG_VOLTAGE), sizeof(uint16_t));
+            PutLittleEndian(&response[8], FuelGaugeSimGetRegister(sim, SIM_REG_VOLTAGE), sizeof(uint16_t));
+            PutLittleEndian(&response[10], FuelGaugeSimGetRegister(sim, SIM_REG_VOLTAGE), sizeof(uint16_t));
+            PutLittleEndian(&response[12], FuelGaugeSimGetRegister(sim, SIM_REG_CURRENT), sizeof(uint16_t));
+            break;
+
+        case SIM_CMD_DA_STATUS2:
+            // internal and TS1 temperature follow Temperature
+            size = 16;
+            PutLittleEndian(&response[0], FuelGaugeSimGetRegister(sim, SIM_REG_TEMPERATURE), sizeof(uint16_t));
+            PutLittleEndian(&response[2], FuelGaugeSimGetRegister(sim, SIM_REG_TEMPERATURE), sizeof(uint16_t));
+            break;
+
+        case SIM_CMD_LIFETIME_DATA:
+            size = 32;
+            break;
+
+        case SIM_CMD_IT_STATUS1:
+        case SIM_CMD_IT_STATUS2:
+            size = 24;
+            break;
+
+        case SIM_CMD_IT_STATUS3:
+            size = 16;
+            break;
+
+        case SIM_CMD_SECURITY_KEYS:
+            if (sim->security != FUEL_GAUGE_SIM_FULL_ACCESS)
+                return false;
+
+            size = sizeof(sim->unsealKey) + sizeof(sim->fullAccessKey);
+            memcpy(response, sim->unsealKey, sizeof(sim->unsealKey));
+            memcpy(&response[sizeof(sim->unsealKey)], sim->fullAccessKey, sizeof(sim->fullAccessKey));
+            break;
+
+        case SIM_CMD_IT_TOGGLE:
+            sim->manufacturingStatus ^= (1 << SIM_IT_ENABLED_BIT);
+            break;
+
+        case SIM_CMD_LIFETIME_TOGGLE:
+            sim->manufacturingStatus ^= (1 << SIM_LF_ENABLED_BIT);
+            break;
+
+        case SIM_CMD_SEAL:
+            sim->security = FUEL_GAUGE_SIM_SEALED;
+            sim->keyStage = 0;
+            break;
+
+        case SIM_CMD_ROM_MODE:
+            if (sim->security == FUEL_GAUGE_SIM_SEALED)
+                return false;
+
+            sim->romMode = true;
+            return true;
+
+        case SIM_CMD_RESET:
+        case SIM_CMD_RESET_LIFETIME:
+            break;
+
+        default:
+            // unknown commands answer with an empty block
+            break;
+    }
+
+    SetMacResponse(sim, command, response, size);
+
+    return true;
+}
+
+// MacDataSum is the complement of the byte sum of address and data, MacDataLen counts them plus 2
+static bool CommitDataFlashWrite(FuelGaugeSim *sim, uint8_t sum, uint8_t length)
+{
+    uint8_t expected = 0;
+
+    for (uint8_t i = 0; i < sim->pendingWriteSize; i++)
+        expected += sim->pendingWrite[i];
+
+    expected = ~expected;
+
+    if (sim->pendingWriteSize == 0 || sum != expected || length != sim->pendingWriteSize + 2) {
+        sim->pendingWriteSize = 0;
+        return false;
+    }
+
+    uint16_t address = ((sim->pendingWrite[1] << 8) | sim->pendingWrite[0]);
+
+    memcpy(&sim->dataFlash[address - FUEL_GAUGE_SIM_DF_START], &sim->pendingWrite[2], sim->pendingWriteSize - 2);
+    sim->pendingWriteSize = 0;
+
+    return true;
+}
+
+static void SetMacResponse(FuelGaugeSim *sim, uint16_t command, const uint8_t *data, uint8_t size)
+{
+    uint8_t sum = 0;
+
+    PutLittleEndian(&sim->regs[SIM_REG_ALT_MNFG_ACCESS], command, sizeof(uint16_t));
+    memset(&sim->regs[SIM_REG_MAC_DATA], 0, FUEL_GAUGE_SIM_MAC_DATA_SIZE);
+    memcpy(&sim->regs[SIM_REG_MAC_DATA], data, size);
+
+    for (uint8_t i = 0; i < size + sizeof(uint16_t); i++)
+        sum += sim->regs[SIM_REG_ALT_MNFG_ACCESS + i];
+
+    sim->regs[SIM_REG_MAC_DATA_SUM] = ~sum;
+    sim->regs[SIM_REG_MAC_DATA_LEN] = size + 4;
+}
+
+static bool IsDataFlashAddress(uint16_t address, uint16_t size)
+{
+    return (address >= FUEL_GAUGE_SIM_DF_START
+            && address + size <= FUEL_GAUGE_SIM_DF_START + FUEL_GAUGE_SIM_DF_SIZE);
+}
+
+static bool MatchesKeyWord(const uint8_t *key, uint16_t word)
+{
+    uint16_t keyWord = ((key[1] << 8) | key[0]);
+    uint16_t swapped = ((key[0] << 8) | key[1]);
+
+    return (word == keyWord || word == swapped);
+}
+
+static void PutLittleEndian(uint8_t *buffer, uint32_t value, uint8_t size)
+{
+    for (uint8_t i = 0; i < size; i++)
+        buffer[i] = (uint8_t) (value >> (8 * i));
+}
+
+// A flag fires when its set threshold is crossed and re-arms past the clear threshold
+static void UpdateInterrupts(FuelGaugeSim *sim)
+{
+    uint16_t voltage = FuelGaugeSimGetRegister(sim, SIM_REG_VOLTAGE);
+    int32_t temperature = ((int32_t) FuelGaugeSimGetRegister(sim, SIM_REG_TEMPERATURE) - 2731) / 10;
+
+    CheckThreshold(sim, SIM_INT_VOLT_HI,
+                   voltage >= FuelGaugeSimGetRegister(sim, SIM_REG_VOLT_HI_SET),
+                   voltage < FuelGaugeSimGetRegister(sim, SIM_REG_VOLT_HI_CLEAR));
+    CheckThreshold(sim, SIM_INT_VOLT_LO,
+                   voltage <= FuelGaugeSimGetRegister(sim, SIM_REG_VOLT_LO_SET),
+                   voltage > FuelGaugeSimGetRegister(sim, SIM_REG_VOLT_LO_CLEAR));
+    CheckThreshold(sim, SIM_INT_TEMP_HI,
+                   temperature >= (int8_t) sim->regs[SIM_REG_TEMP_HI_SET],
+                   temperature < (int8_t) sim->regs[SIM_REG_TEMP_HI_CLEAR]);
+    CheckThreshold(sim, SIM_INT_TEMP_LO,
+                   temperature <= (int8_t) sim->regs[SIM_REG_TEMP_LO_SET],
+                   temperature > (int8_t) sim->regs[SIM_REG_TEMP_LO_CLEAR]);
+}
+
+static void CheckThreshold(FuelGaugeSim *sim, uint8_t flag, bool set, bool clear)
+{
+    if (set == true && (sim->interruptArmed & flag) != 0) {
+        sim->interruptArmed &= ~flag;
+        sim->regs[SIM_REG_INTERRUPT_STATUS] |= flag;
+        sim->interruptPin = true;
+    } else if (clear == true) {
+        sim->interruptArmed |= flag;
+    }
+}
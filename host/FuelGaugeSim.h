@@ -0,0 +1,151 @@
+#ifndef HOST_FUEL_GAUGE_SIM_H_
+#define HOST_FUEL_GAUGE_SIM_H_
+
+/*
+ * Note:    Simulated BQ27Z561 behind a TwiInterface, for running and timing the
+ *          driver on a host without hardware. Bus time is modeled, not measured:
+ *          every transfer advances the simulator clock by its length on the wire.
+ *
+*/
+#include "TwiInterface.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+#define FUEL_GAUGE_SIM_REG_COUNT            0x80
+#define FUEL_GAUGE_SIM_DF_START             0x4000
+#define FUEL_GAUGE_SIM_DF_SIZE              0x2000
+#define FUEL_GAUGE_SIM_MAC_DATA_SIZE        32
+#define FUEL_GAUGE_SIM_BUS_FREE_NS          66000
+
+
+typedef enum {
+    FUEL_GAUGE_SIM_SEALED,
+    FUEL_GAUGE_SIM_UNSEALED,
+    FUEL_GAUGE_SIM_FULL_ACCESS,
+} FuelGaugeSimSecurity;
+
+/**
+* \brief Bus timing model.
+*
+* A transfer costs startStopNs plus byteNs for every byte on the wire,
+* address bytes included. byteNs of 0 derives it from the speed the bus was
+* opened with (9 bit times per byte).
+*/
+typedef struct {
+    uint32_t byteNs;
+    uint32_t startStopNs;
+    uint32_t openNs;
+    uint32_t closeNs;
+} FuelGaugeSimTiming;
+
+typedef struct {
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t opens;
+    uint32_t closes;
+    uint32_t nacks;
+    uint32_t busFreeViolations;     // transactions started less than 66 us after the previous one
+} FuelGaugeSimStats;
+
+typedef struct {
+    uint8_t address;
+    uint8_t romAddress;
+    uint8_t unsealKey[4];
+    uint8_t fullAccessKey[4];
+    FuelGaugeSimTiming timing;
+
+    // fault injection: NACK nackCount transactions after letting nackSkip through
+    uint32_t nackSkip;
+    uint32_t nackCount;
+    uint32_t corruptCount;          // flip a bit in the first byte of this many reads
+    uint32_t openFailCount;         // fail this many bus opens
+
+    // device state
+    bool romMode;
+    bool busOpen;
+    TwiSpeed speed;
+    FuelGaugeSimSecurity security;
+    uint8_t keyStage;
+    uint8_t regs[FUEL_GAUGE_SIM_REG_COUNT];
+    uint8_t romRegs[0x100];
+    uint8_t dataFlash[FUEL_GAUGE_SIM_DF_SIZE];
+    uint16_t manufacturingStatus;
+    uint32_t operationStatus;
+    uint32_t chargingStatus;
+    uint32_t gaugingStatus;
+    uint16_t chemId;
+    uint8_t firmwareVersion[11];
+    uint8_t pendingWrite[2 + FUEL_GAUGE_SIM_MAC_DATA_SIZE];
+    uint8_t pendingWriteSize;
+    uint8_t interruptArmed;         // InterruptStatus flags that may fire again
+    bool interruptPin;              // GPOUT, asserted until InterruptStatus is read
+
+    // modeled time
+    uint64_t timeNs;
+    uint64_t lastStopNs;
+    bool anyTransaction;
+
+    FuelGaugeSimStats stats;
+} FuelGaugeSim;
+
+
+/**
+* \brief Setup a simulated gauge: sealed, in firmware mode, at 0x55 and 0x0B,
+* with the keys of FuelGauge.c and plausible standard register values.
+*/
+void FuelGaugeSimInit(FuelGaugeSim *sim);
+
+/**
+* \brief Selects the gauge served by FuelGaugeSimGetTwi() (one at a time).
+*/
+void FuelGaugeSimAttach(FuelGaugeSim *sim);
+
+/**
+* \brief Selects the gauge served to the calling thread only, over the one
+* of FuelGaugeSimAttach(); NULL goes back to that one. Lets threads drive
+* gauges on separate simulated buses.
+*/
+void FuelGaugeSimAttachThread(FuelGaugeSim *sim);
+
+/**
+* \brief Gets a TwiInterface talking to the attached simulated gauge.
+*/
+TwiInterface *FuelGaugeSimGetTwi(void);
+
+/**
+* \brief Sets a 16-bit standard register (little-endian). Voltage and
+* Temperature are checked against the thresholds, raising InterruptStatus
+* flags and GPOUT like the gauge does.
+*/
+void FuelGaugeSimSetRegister(FuelGaugeSim *sim, uint8_t registerAddress, uint16_t value);
+
+/**
+* \brief Gets a 16-bit standard register (little-endian).
+*/
+uint16_t FuelGaugeSimGetRegister(const FuelGaugeSim *sim, uint8_t registerAddress);
+
+/**
+* \brief Raw bus access, for adapters other than TwiInterface. A write sends
+* data (register address first), a read sends the register address and
+* reads size bytes back with a repeated start.
+*
+* \return false if the gauge NACKs.
+*/
+bool FuelGaugeSimWrite(FuelGaugeSim *sim, uint8_t address, const uint8_t *data, uint16_t size);
+bool FuelGaugeSimRead(FuelGaugeSim *sim, uint8_t address, uint8_t registerAddress, uint8_t *data, uint16_t size);
+
+/**
+* \brief Modeled time of the attached gauge, usable as a FuelGaugeClock.
+*/
+uint32_t FuelGaugeSimGetTimeUs(void);
+void FuelGaugeSimDelayUs(uint32_t us);
+
+/**
+* \brief Modeled time of the attached gauge in milliseconds, wrapping after
+* 49 days instead of the 71 minutes of FuelGaugeSimGetTimeUs().
+*/
+uint32_t FuelGaugeSimGetTimeMs(void);
+
+#endif  // HOST_FUEL_GAUGE_SIM_H_
@@ -0,0 +1,345 @@
+/*
+ * FuelGaugeSimMain.c
+ *
+ * Runs the driver against the simulated gauge: reads the standard and MAC
+ * values, cycles the security modes and programs the golden image, printing
+ * the modeled bus time of each step. Finishes with an hour of telemetry,
+ * a scheduler run publishing to a reader, threads sharing the gauge
+ * through the arbiter and a sweep over a rack of gauges on several buses.
+ */
+
+#include "FuelGauge.h"
+#include "FuelGaugeArbiter.h"
+#include "FuelGaugeFleet.h"
+#include "FuelGaugeSim.h"
+#include "FuelGaugePublisher.h"
+#include "FuelGaugeTelemetry.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+
+#define ARBITER_ROUNDS  200
+#define FLEET_BUSES     8
+#define FLEET_PER_BUS   6
+#define FLEET_DEVICES   (FLEET_BUSES * FLEET_PER_BUS)
+
+
+extern const char goldenImage [];
+
+static FuelGaugeSim sim;
+
+static FuelGaugeTelemetry telemetry;
+static FuelGaugeScheduler scheduler;
+static FuelGaugePublisher publisher;
+
+static FuelGaugeArbiter arbiter;
+static pthread_mutex_t arbiterMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t arbiterCondition = PTHREAD_COND_INITIALIZER;
+
+static FuelGaugeSim fleetSims[FLEET_DEVICES];
+static FuelGaugeDevice fleetDevices[FLEET_DEVICES];
+static FuelGaugeFleetDevice fleetEntries[FLEET_DEVICES];
+static FuelGaugeFleetBus fleetBuses[FLEET_BUSES];
+static FuelGaugePublisher fleetTable[FLEET_DEVICES];
+
+static int failures = 0;
+static int arbiterFailures = 0;
+
+
+static void ArbiterLock(void *context)
+{
+    pthread_mutex_lock(context);
+}
+
+static void ArbiterUnlock(void *context)
+{
+    pthread_mutex_unlock(context);
+}
+
+static void ArbiterWait(void *context)
+{
+    (void) context;
+    pthread_cond_wait(&arbiterCondition, &arbiterMutex);
+}
+
+static void ArbiterBroadcast(void *context)
+{
+    (void) context;
+    pthread_cond_broadcast(&arbiterCondition);
+}
+
+// A control loop reading the voltage, next to a thread reading MAC values
+static void *ArbiterThread(void *context)
+{
+    uint8_t priority = *(const uint8_t *) context;
+
+    for (int round = 0; round < ARBITER_ROUNDS; round++) {
+        uint16_t value;
+
+        if (FuelGaugeArbiterAcquire(&arbiter, priority) == false) {
+            __atomic_fetch_add(&arbiterFailures, 1, __ATOMIC_RELAXED);
+            continue;
+        }
+
+        bool result = (priority == FUEL_GAUGE_PRIORITY_CRITICAL) ? FuelGaugeGetVoltage(&value)
+                                                                 : FuelGaugeGetChemId(&value);
+
+        FuelGaugeArbiterRelease(&arbiter);
+
+        if (result == false)
+            __atomic_fetch_add(&arbiterFailures, 1, __ATOMIC_RELAXED);
+    }
+
+    return NULL;
+}
+
+// Each rack gauge is its own simulator, attached to the bus worker before it is polled
+static void SelectFleetGauge(void *context)
+{
+    FuelGaugeSimAttachThread(context);
+}
+
+static void Report(const char *name, bool result, uint64_t startNs)
+{
+    printf("%-28s %-4s %8.3f ms\n", name, (result == true) ? "ok" : "FAIL",
+           (sim.timeNs - startNs) / 1e6);
+
+    if (result == false)
+        failures++;
+}
+
+#define RUN(name, call)                         \
+    do {                                        \
+        uint64_t startNs = sim.timeNs;          \
+        bool result = (call);                   \
+        Report(name, result, startNs);          \
+    } while (0)
+
+
+int main(void)
+{
+    static const FuelGaugeClock clock = {
+        .getTimeUs = FuelGaugeSimGetTimeUs,
+        .delayUs = FuelGaugeSimDelayUs,
+    };
+
+    static const FuelGaugeSchedulerConfig schedulerConfig = {
+        .getTimeMs = FuelGaugeSimGetTimeMs,
+        .bounds = {
+            [FUEL_GAUGE_POLL_SNAPSHOT] = {1000, 10000},
+            [FUEL_GAUGE_POLL_STATUS] = {2000, 30000},
+        },
+        .fullLoadCurrentMa = 3000,
+        .fullSocSlopePerHour = 60,
+        .callback = FuelGaugePublisherPollCallback,
+        .context = &publisher,
+    };
+
+    FuelGaugePublication publication;
+    uint16_t value16;
+    int16_t current;
+    uint32_t value32;
+    uint8_t value8;
+    uint16_t daStatus1[16];
+    FuelGaugeDiagnostics diagnostics;
+    FuelGaugeSnapshot snapshot;
+
+    FuelGaugeSimInit(&sim);
+    // the simulator does not compute the data flash checksum; report the one the image expects
+    sim.romRegs[0x14] = 0xCF;
+    sim.romRegs[0x15] = 0x1A;
+
+    FuelGaugeSimAttach(&sim);
+    FuelGaugeInitTwi(FuelGaugeSimGetTwi());
+    FuelGaugeInitClock(&clock);
+
+    RUN("GetVoltage", FuelGaugeGetVoltage(&value16));
+    printf("    voltage %u mV\n", value16);
+    RUN("GetCurrent", FuelGaugeGetCurrent(&current));
+    printf("    current %d mA\n", current);
+    RUN("GetRelativeSoc", FuelGaugeGetRelativeSoc(&value16));
+    printf("    soc %u %%\n", value16);
+    RUN("ReadSnapshot", FuelGaugeReadSnapshot(&snapshot));
+    RUN("GetOperationStatus", FuelGaugeGetOperationStatus(&value32));
+    RUN("GetGaugingStatus", FuelGaugeGetGaugingStatus(&value32));
+    RUN("GetChargingStatus", FuelGaugeGetChargingStatus(&value32));
+    RUN("GetChemId", FuelGaugeGetChemId(&value16));
+    printf("    chem id 0x%04x\n", value16);
+    RUN("ReadMac DA_STATUS1", FuelGaugeReadMac(FUEL_GAUGE_MAC_DA_STATUS1, daStatus1));
+    printf("    cell 1 %u mV, pack %u mV\n", daStatus1[0], daStatus1[5]);
+    RUN("ReadDiagnostics", FuelGaugeReadDiagnostics(&diagnostics));
+    printf("    %u bytes, bus time %u us\n", (unsigned) sizeof(diagnostics), diagnostics.busTimeUs);
+
+    RUN("Unseal", FuelGaugeUnseal());
+    RUN("FullAccess", FuelGaugeFullAccess());
+    RUN("GetManufacturingStatus", FuelGaugeGetManufacturingStatus(&value16));
+    // data flash is only readable once unsealed
+    RUN("GetUpdateStatus", FuelGaugeGetUpdateStatus(&value8));
+    RUN("EnableLifetimeTracking", FuelGaugeEnableLifetimeTracking());
+    // returns whether tracking is still enabled
+    RUN("DisableImpedanceTracking", FuelGaugeDisableImpedanceTracking() == false);
+    RUN("EnableImpedanceTracking", FuelGaugeEnableImpedanceTracking());
+    RUN("Seal", FuelGaugeSeal());
+
+    RUN("ExecuteGoldenImage", FuelGaugeExecuteGoldenImage() == ERROR_NONE);
+
+    // a minute between samples, a slowly discharging pack
+    FuelGaugeTelemetryInit(&telemetry);
+    for (int minute = 0; minute < 60; minute++) {
+        FuelGaugeSimSetRegister(&sim, 0x08, 3900 - minute);
+        FuelGaugeSimSetRegister(&sim, 0x0C, (uint16_t) (-250 - (minute % 3)));
+
+        if (FuelGaugeReadSnapshot(&snapshot) == true)
+            FuelGaugeTelemetryAppend(&telemetry, minute * 60000, &snapshot, 0);
+    }
+    printf("\ntelemetry %u samples in %u bytes, %u bytes raw\n", telemetry.count, telemetry.used,
+           (unsigned) (telemetry.count * sizeof(FuelGaugeTelemetrySample)));
+
+    // the scheduler is the only bus user, readers only see its publications
+    FuelGaugePublisherInit(&publisher);
+    FuelGaugeSchedulerInit(&scheduler, FuelGaugeGetDefaultDevice(), &schedulerConfig);
+    RUN("SchedulerRun", FuelGaugeSchedulerRun(&scheduler) != 0);
+    RUN("PublisherRead", FuelGaugePublisherRead(&publisher, &publication));
+    printf("    publication %u, %u mV, operation status 0x%08x\n", publication.sequence,
+           publication.snapshot.voltage, publication.operationStatus);
+
+    printf("\ntransactions %u, bytes %u, opens %u, closes %u, nacks %u, bus free violations %u\n",
+           sim.stats.transactions, sim.stats.bytes, sim.stats.opens, sim.stats.closes,
+           sim.stats.nacks, sim.stats.busFreeViolations);
+    printf("modeled bus time %.3f ms\n", sim.timeNs / 1e6);
+
+#ifdef FUEL_GAUGE_ENABLE_STATS
+    static const char *const requestNames [] = {"read", "primed read", "write"};
+    FuelGaugeStats stats;
+
+    FuelGaugeGetStats(&stats);
+
+    printf("\nbus open failures %u\n", stats.openFailures);
+    for (int type = 0; type < FUEL_GAUGE_REQUEST_TYPE_COUNT; type++) {
+        const FuelGaugeRequestStats *request = &stats.requests[type];
+
+        printf("%-12s calls %u, failures %u, retries %u, latency (us, log2):",
+               requestNames[type], request->calls, request->failures, request->retries);
+        for (int bucket = 0; bucket < FUEL_GAUGE_STATS_BUCKETS; bucket++) {
+            if (request->latency[bucket] == 0)
+                continue;
+
+            if (bucket == FUEL_GAUGE_STATS_BUCKETS - 1)
+                printf(" >=%u:%u", 1u << (bucket - 1), request->latency[bucket]);
+            else
+                printf(" <%u:%u", 1u << bucket, request->latency[bucket]);
+        }
+        printf("\n");
+    }
+#endif
+
+    static const FuelGaugeArbiterLock arbiterLock = {
+        .lock = ArbiterLock,
+        .unlock = ArbiterUnlock,
+        .wait = ArbiterWait,
+        .broadcast = ArbiterBroadcast,
+        .context = &arbiterMutex,
+    };
+    static const uint8_t priorities [] = {FUEL_GAUGE_PRIORITY_CRITICAL, FUEL_GAUGE_PRIORITY_NORMAL};
+    pthread_t threads[2];
+
+    // a long diagnostics job yields to the voltage reads in between sweeps
+    FuelGaugeArbiterInit(&arbiter, FuelGaugeGetDefaultDevice(), &arbiterLock);
+    bool bulkResult = FuelGaugeArbiterAcquire(&arbiter, FUEL_GAUGE_PRIORITY_BULK);
+
+    for (int index = 0; index < 2; index++)
+        pthread_create(&threads[index], NULL, ArbiterThread, (void *) &priorities[index]);
+
+    // let both threads queue up behind the job
+    for (uint8_t waiting = 0; bulkResult == true && waiting < 2; ) {
+        pthread_mutex_lock(&arbiterMutex);
+        waiting = arbiter.waiterCount;
+        pthread_mutex_unlock(&arbiterMutex);
+    }
+
+    if (bulkResult == true) {
+        for (int round = 0; round < ARBITER_ROUNDS / 4; round++) {
+            bulkResult &= FuelGaugeReadDiagnostics(&diagnostics);
+            FuelGaugeArbiterYield(&arbiter);
+        }
+
+        // then the golden image, which yields only while the gauge runs firmware
+        FuelGaugeImageMemory memory = {
+            .text = goldenImage,
+            .size = strlen(goldenImage),
+        };
+        FuelGaugeImageReader source = {
+            .read = FuelGaugeImageMemoryRead,
+            .context = &memory,
+        };
+        FuelGaugeArbiterImageReader yielding = {
+            .arbiter = &arbiter,
+            .reader = &source,
+        };
+        FuelGaugeImageReader reader = {
+            .read = FuelGaugeArbiterImageRead,
+            .rewind = FuelGaugeArbiterImageRewind,
+            .context = &yielding,
+        };
+
+        bulkResult &= (FuelGaugeExecuteGoldenImageStream(&reader) == ERROR_NONE);
+        FuelGaugeArbiterRelease(&arbiter);
+    }
+
+    for (int index = 0; index < 2; index++)
+        pthread_join(threads[index], NULL);
+
+    printf("\narbiter: diagnostics and golden image %s, %d failed reads, %u grants, %u without reopening the bus\n",
+           (bulkResult == true) ? "ok" : "FAIL", arbiterFailures, arbiter.grants, arbiter.handoffs);
+
+    if (bulkResult == false || arbiterFailures > 0)
+        failures++;
+
+    FuelGaugeFleet fleet;
+    FuelGaugePublication fleetPublication;
+    uint64_t startNs[FLEET_DEVICES];
+    uint64_t busNs[FLEET_BUSES] = {0};
+    uint64_t sweepNs = 0;
+    uint64_t sequentialNs = 0;
+
+    for (int index = 0; index < FLEET_DEVICES; index++) {
+        FuelGaugeSimInit(&fleetSims[index]);
+        FuelGaugeSimSetRegister(&fleetSims[index], 0x08, 3700 + index);
+        startNs[index] = fleetSims[index].timeNs;
+
+        FuelGaugeDeviceInit(&fleetDevices[index], FuelGaugeSimGetTwi());
+        FuelGaugeDeviceInitClock(&fleetDevices[index], &clock);
+        fleetEntries[index].device = &fleetDevices[index];
+        fleetEntries[index].select = SelectFleetGauge;
+        fleetEntries[index].context = &fleetSims[index];
+    }
+    for (int index = 0; index < FLEET_BUSES; index++) {
+        fleetBuses[index].devices = &fleetEntries[index * FLEET_PER_BUS];
+        fleetBuses[index].count = FLEET_PER_BUS;
+    }
+
+    FuelGaugeFleetInit(&fleet, fleetBuses, FLEET_BUSES, fleetTable, FLEET_DEVICES, FuelGaugeSimGetTimeMs);
+    bool fleetResult = FuelGaugeFleetSweep(&fleet);
+
+    // every bus has its own modeled clock, the sweep lasts as long as the busiest one
+    for (int index = 0; index < FLEET_DEVICES; index++)
+        busNs[index / FLEET_PER_BUS] += fleetSims[index].timeNs - startNs[index];
+    for (int index = 0; index < FLEET_BUSES; index++) {
+        sequentialNs += busNs[index];
+        if (busNs[index] > sweepNs)
+            sweepNs = busNs[index];
+    }
+
+    fleetResult &= FuelGaugeFleetRead(&fleet, FLEET_DEVICES - 1, &fleetPublication);
+    fleetResult &= (fleetPublication.snapshot.voltage == 3700 + FLEET_DEVICES - 1);
+
+    printf("fleet: %s, %d gauges on %d buses, sweep %.3f ms instead of %.3f ms one bus after the other\n",
+           (fleetResult == true) ? "ok" : "FAIL", FLEET_DEVICES, FLEET_BUSES, sweepNs / 1e6, sequentialNs / 1e6);
+
+    if (fleetResult == false)
+        failures++;
+
+    return (failures == 0) ? 0 : 1;
+}
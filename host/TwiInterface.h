@@ -0,0 +1,29 @@
+/*
+ * TwiInterface.h
+ *
+ * Host definition of the I2C/TWI interface the driver expects from the
+ * platform, used to build the driver on Linux against the simulator.
+ */
+
+#ifndef HOST_TWI_INTERFACE_H_
+#define HOST_TWI_INTERFACE_H_
+
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+typedef enum {
+    TWI_100KHZ,
+    TWI_400KHZ,
+} TwiSpeed;
+
+typedef struct {
+    bool (*open)(TwiSpeed speed);
+    bool (*read)(uint8_t address, const uint8_t *reg, uint8_t regSize, void *data, uint8_t size);
+    bool (*write)(uint8_t address, const uint8_t *reg, uint8_t regSize, const uint8_t *data, uint8_t size);
+    void (*close)(void);
+} TwiInterface;
+
+
+#endif
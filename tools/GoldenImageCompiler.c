@@ -0,0 +1,160 @@
+/*
+ * GoldenImageCompiler.c
+ *
+ * Host tool converting a df.fs flash stream into the packed record stream
+ * described in GoldenImageFormat.h, written as a C header on stdout.
+ *
+ * Build:   cc -I.. -o GoldenImageCompiler GoldenImageCompiler.c
+ * Usage:   GoldenImageCompiler df.fs [arrayName] > GoldenImageBinary.h
+ */
+
+#include "GoldenImageFormat.h"
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define MAX_LINE_LENGTH     1024
+#define MAX_PAYLOAD_BYTES   UINT8_MAX   // must fit the length byte of the record
+#define MAX_LINE_BYTES      (MAX_LINE_LENGTH / 2)
+
+
+static int ParseHexBytes(const char *text, uint8_t *bytes, int maxBytes);
+static void EmitRecord(const char *opcode, const uint8_t *bytes, int count);
+
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "usage: %s df.fs [arrayName]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const char *arrayName = (argc == 3) ? argv[2] : "goldenImageBinary";
+    FILE *file = fopen(argv[1], "r");
+
+    if (file == NULL) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    printf("/*\n"
+           " * Generated by tools/GoldenImageCompiler from %s. Do not edit.\n"
+           " *\n"
+           " * Record layout is described in GoldenImageFormat.h.\n"
+           " */\n\n"
+           "#ifndef FUEL_GAUGE_GOLDEN_IMAGE_BINARY_H_\n"
+           "#define FUEL_GAUGE_GOLDEN_IMAGE_BINARY_H_\n\n\n"
+           "#include \"GoldenImageFormat.h\"\n\n"
+           "#include <stdint.h>\n\n\n"
+           "static const uint8_t %s [] = {\n", argv[1], arrayName);
+
+    char line[MAX_LINE_LENGTH];
+    unsigned lineNumber = 0;
+    unsigned long size = 0;
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        lineNumber++;
+
+        char *text = line;
+
+        while (isspace((unsigned char) *text))
+            text++;
+
+        // blank lines and ';' comments carry no operation
+        if (*text == 0 || *text == ';')
+            continue;
+
+        if (text[1] != ':') {
+            fprintf(stderr, "%s:%u: expected '<op>:'\n", argv[1], lineNumber);
+            return EXIT_FAILURE;
+        }
+
+        if (text[0] == 'W' || text[0] == 'C') {
+            uint8_t bytes[MAX_LINE_BYTES];
+            int count = ParseHexBytes(&text[2], bytes, sizeof(bytes));
+
+            if (count < FUEL_GAUGE_IMAGE_RECORD_HEADER) {
+                fprintf(stderr, "%s:%u: malformed '%c:' line\n", argv[1], lineNumber, text[0]);
+                return EXIT_FAILURE;
+            }
+
+            // address and register come first, the rest is the payload
+            if (count - 2 > MAX_PAYLOAD_BYTES) {
+                fprintf(stderr, "%s:%u: '%c:' payload of %d bytes, at most %d\n",
+                        argv[1], lineNumber, text[0], count - 2, MAX_PAYLOAD_BYTES);
+                return EXIT_FAILURE;
+            }
+
+            // insert the payload length after address and register
+            uint8_t record[FUEL_GAUGE_IMAGE_RECORD_HEADER + MAX_PAYLOAD_BYTES];
+            record[0] = bytes[0];
+            record[1] = bytes[1];
+            record[2] = (uint8_t) (count - 2);
+            memcpy(&record[3], &bytes[2], count - 2);
+
+            EmitRecord((text[0] == 'W') ? "FUEL_GAUGE_IMAGE_OP_WRITE" : "FUEL_GAUGE_IMAGE_OP_COMPARE",
+                       record, count + 1);
+            size += count + 2;
+        } else if (text[0] == 'X') {
+            char *end;
+            unsigned long delay = strtoul(&text[2], &end, 10);
+
+            if (end == &text[2] || delay > UINT16_MAX) {
+                fprintf(stderr, "%s:%u: malformed 'X:' line\n", argv[1], lineNumber);
+                return EXIT_FAILURE;
+            }
+
+            uint8_t record[] = {(uint8_t) delay, (uint8_t) (delay >> 8)};
+
+            EmitRecord("FUEL_GAUGE_IMAGE_OP_DELAY", record, sizeof(record));
+            size += sizeof(record) + 1;
+        } else {
+            fprintf(stderr, "%s:%u: unknown operation '%c'\n", argv[1], lineNumber, text[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    fclose(file);
+
+    printf("};\n\n"
+           "// %lu bytes\n\n\n"
+           "#endif\n", size);
+
+    return EXIT_SUCCESS;
+}
+
+// Parses hex byte pairs, optionally separated by spaces; returns count or -1
+static int ParseHexBytes(const char *text, uint8_t *bytes, int maxBytes)
+{
+    int count = 0;
+
+    while (*text != 0) {
+        if (isspace((unsigned char) *text)) {
+            text++;
+            continue;
+        }
+
+        if (!isxdigit((unsigned char) text[0]) || !isxdigit((unsigned char) text[1]) || count == maxBytes)
+            return -1;
+
+        char pair[] = {text[0], text[1], 0};
+        bytes[count++] = (uint8_t) strtoul(pair, NULL, 16);
+        text += 2;
+    }
+
+    return count;
+}
+
+static void EmitRecord(const char *opcode, const uint8_t *bytes, int count)
+{
+    printf("    %s,", opcode);
+
+    for (int i = 0; i < count; i++)
+        printf(" 0x%02X,", bytes[i]);
+
+    printf("\n");
+}